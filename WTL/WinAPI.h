@@ -30,6 +30,8 @@ namespace wtl
     //! Functions 'C'
     static constexpr auto callWindowProc = choose<encoding>(::CallWindowProcA,::CallWindowProcW);
     static constexpr auto createFont = choose<encoding>(::CreateFontA,::CreateFontW);
+    static constexpr auto createFile = choose<encoding>(::CreateFileA,::CreateFileW);
+    static constexpr auto createFileMapping = choose<encoding>(::CreateFileMappingA,::CreateFileMappingW);
     static constexpr auto createWindowEx = choose<encoding>(::CreateWindowExA,::CreateWindowExW);
     
     //! Functions 'D'
@@ -0,0 +1,387 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\AsyncLogQueue.hpp
+//! \brief Provides a double-buffered queue that moves log output off the calling thread
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_ASYNC_LOG_QUEUE_HPP
+#define WTL_ASYNC_LOG_QUEUE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/threads/WorkerThread.hpp>   //!< WorkerThread
+#include <atomic>                         //!< std::atomic
+#include <chrono>                         //!< std::chrono
+#include <condition_variable>             //!< std::condition_variable
+#include <cstring>                        //!< std::memcpy
+#include <functional>                     //!< std::function
+#include <memory>                         //!< std::unique_ptr
+#include <mutex>                          //!< std::mutex
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum OverflowPolicy - Defines the behaviour of writers when the front buffer is full
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class OverflowPolicy
+  {
+    Drop,       //!< Discard the record and count it
+    Block,      //!< Wait until the buffers are swapped
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LogStatistics - Latency and throughput statistics of an asynchronous log
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LogStatistics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias duration_t - Latency duration type
+    using duration_t = std::chrono::microseconds;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    uint64_t    Records = 0;          //!< Records written to the sink
+    uint64_t    Bytes = 0;            //!< Bytes written to the sink, excluding record headers
+    uint64_t    Dropped = 0;          //!< Records discarded because the front buffer was full
+    uint64_t    Stalls = 0;           //!< Writers blocked because the front buffer was full
+    uint64_t    Flushes = 0;          //!< Back buffers written to the sink
+    duration_t  FlushTime {0};        //!< Total time spent writing back buffers to the sink
+    duration_t  MaxFlushLatency {0};  //!< Longest time spent writing a single back buffer to the sink
+    duration_t  MaxRecordLatency {0}; //!< Longest time between a buffer receiving its first record and being written
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LogStatistics::throughput const
+    //! Get the sink throughput
+    //!
+    //! \return double - Bytes written per second of flush time
+    /////////////////////////////////////////////////////////////////////////////////////////
+    double throughput() const
+    {
+      return FlushTime.count() ? Bytes * 1e6 / FlushTime.count() : 0.0;
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct AsyncLogQueue - Multiple-producer, single-consumer queue of log records backed by a pair of buffers
+  //!
+  //! \remarks Writers reserve space within the front buffer with a single compare-and-swap upon a word holding both
+  //! \remarks the front buffer index and its length, then copy their record and publish it. A dedicated thread
+  //! \remarks periodically swaps the buffers with the same compare-and-swap, waits for pending copies into the old
+  //! \remarks front buffer to be published, then passes each record to the sink. Writers only take a lock when the
+  //! \remarks front buffer is full and the policy is to block, or when waiting upon a flush barrier.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct AsyncLogQueue
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = AsyncLogQueue;
+
+    //! \alias sink_t - Consumer of records, invoked upon the flush thread with (attributes, text, length)
+    using sink_t = std::function<void (uint32_t, const char*, uint32_t)>;
+
+    //! \alias flush_t - Flushes the sink, invoked upon the flush thread after each back buffer is written
+    using flush_t = std::function<void ()>;
+
+    //! \alias clock_t - Latency clock
+    using clock_t = std::chrono::steady_clock;
+
+  protected:
+    //! \struct RecordHeader - Precedes the text of each record
+    struct RecordHeader
+    {
+      uint32_t  Attributes;     //!< Caller-defined attributes
+      uint32_t  Length;         //!< Length of text, in bytes
+    };
+
+    //! \struct Buffer - Holds records
+    struct Buffer
+    {
+      std::unique_ptr<char[]>             Data;         //!< Record storage
+      std::atomic<uint32_t>               Published;    //!< Number of bytes fully copied by writers
+      std::atomic<clock_t::rep>           FirstRecord;  //!< Time at which the first record was reserved, if any
+    };
+
+    //! \var IndexBit - Bit of the front buffer state holding the index of the front buffer
+    static constexpr uint64_t  IndexBit = 1ULL << 32;
+
+    //! \var ClosedBit - Bit of the front buffer state set by the final swap, after which nothing is reserved
+    static constexpr uint64_t  ClosedBit = 1ULL << 33;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    Buffer                    Buffers[2];       //!< Front and back buffers
+    std::atomic<uint64_t>     Front;            //!< Whether closed (bit 33), index of front buffer (bit 32) and its reserved length (bits 0-31)
+    const uint32_t            Capacity;         //!< Capacity of each buffer, in bytes
+    const OverflowPolicy      Policy;           //!< Behaviour when the front buffer is full
+    const clock_t::duration   Interval;         //!< Maximum interval between flushes
+    sink_t                    Sink;             //!< Record consumer
+    flush_t                   Flusher;          //!< Sink flush
+
+    mutable std::mutex        Mutex;            //!< Guards waits upon the flush thread
+    std::condition_variable   Wake,             //!< Signalled to wake the flush thread
+                              Swapped;          //!< Signalled after each flush cycle
+    std::atomic<uint64_t>     Requested,        //!< Flush barriers requested
+                              Completed;        //!< Flush barriers completed
+    std::atomic<uint64_t>     Dropped,          //!< Records dropped
+                              Stalls;           //!< Writers blocked
+    LogStatistics             Statistics;       //!< Flush thread statistics (guarded by Mutex)
+    std::atomic<bool>         Closing;          //!< Whether the flush thread should exit (modified under Mutex)
+    WorkerThread              Thread;           //!< Flush thread
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::AsyncLogQueue
+    //! Create buffers and start the flush thread
+    //!
+    //! \param[in] const& sink - Record consumer, invoked upon the flush thread
+    //! \param[in] const& flush - Sink flush, invoked upon the flush thread after each back buffer is written
+    //! \param[in] capacity - Capacity of each buffer, in bytes
+    //! \param[in] policy - Behaviour of writers when the front buffer is full
+    //! \param[in] interval - [optional] Maximum interval between flushes  (Default is 50ms)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    AsyncLogQueue(const sink_t& sink, const flush_t& flush, uint32_t capacity, OverflowPolicy policy,
+                  clock_t::duration interval = std::chrono::milliseconds(50))
+      : Front(0),
+        Capacity(capacity),
+        Policy(policy),
+        Interval(interval),
+        Sink(sink),
+        Flusher(flush),
+        Requested(0),
+        Completed(0),
+        Dropped(0),
+        Stalls(0),
+        Closing(false)
+    {
+      for (auto& b : Buffers)
+      {
+        b.Data.reset(new char[capacity]);
+        b.Published = 0;
+        b.FirstRecord = 0;
+      }
+
+      // Start flush thread last
+      Thread = WorkerThread(&AsyncLogQueue::run, this);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(AsyncLogQueue);      //!< Cannot be copied
+    DISABLE_MOVE(AsyncLogQueue);      //!< Cannot be moved; the flush thread refers to it
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::~AsyncLogQueue
+    //! Writes remaining records then stops the flush thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~AsyncLogQueue()
+    {
+      close();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::statistics const
+    //! Get a snapshot of the latency and throughput statistics
+    //!
+    //! \return LogStatistics - Statistics
+    /////////////////////////////////////////////////////////////////////////////////////////
+    LogStatistics statistics() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      LogStatistics s = Statistics;
+      s.Dropped = Dropped;
+      s.Stalls = Stalls;
+      return s;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::close
+    //! Writes remaining records then stops the flush thread. Subsequent records are dropped.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Closing = true;
+      }
+      Wake.notify_one();
+
+      if (Thread.joinable())
+        Thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::flush
+    //! Waits until all records written before the call have been passed to the sink and the sink flushed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      std::unique_lock<std::mutex> lock(Mutex);
+      if (Closing)
+        return;
+
+      // Request barrier then wait for the flush cycle that observes it
+      uint64_t barrier = ++Requested;
+      Wake.notify_one();
+      Swapped.wait(lock, [&] { return Completed >= barrier || Closing; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::write
+    //! Appends a record to the front buffer
+    //!
+    //! \param[in] attributes - Caller-defined attributes
+    //! \param[in] const* text - Text
+    //! \param[in] length - Length of text, in bytes
+    //! \return bool - True if queued, false if dropped
+    //!
+    //! \throw wtl::length_error - Record exceeds buffer capacity
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool write(uint32_t attributes, const char* text, uint32_t length)
+    {
+      const uint32_t size = sizeof(RecordHeader) + length;
+      if (size > Capacity)
+        throw wtl::length_error(HERE, "Log record of ", length, " bytes exceeds buffer capacity");
+
+      // [CLOSED] Drop record
+      if (Closing)
+      {
+        ++Dropped;
+        return false;
+      }
+
+      for (uint64_t front = Front.load(std::memory_order_acquire); ; )
+      {
+        const uint32_t reserved = static_cast<uint32_t>(front);
+
+        // [CLOSED] Drop record, since the final buffer has already been swapped out
+        if (front & ClosedBit)
+        {
+          ++Dropped;
+          return false;
+        }
+
+        // Reserve space, retrying if another writer or the flush thread intervened
+        if (reserved + size <= Capacity)
+        {
+          if (!Front.compare_exchange_weak(front, front + size, std::memory_order_acq_rel, std::memory_order_acquire))
+            continue;
+
+          Buffer& buffer = Buffers[front >> 32];
+          if (reserved == 0)
+            buffer.FirstRecord.store(clock_t::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+          // Copy record then publish
+          RecordHeader header { attributes, length };
+          std::memcpy(&buffer.Data[reserved], &header, sizeof(header));
+          std::memcpy(&buffer.Data[reserved + sizeof(header)], text, length);
+          buffer.Published.fetch_add(size, std::memory_order_release);
+
+          // Wake the flush thread early once half full
+          if (reserved < Capacity / 2 && reserved + size >= Capacity / 2)
+            Wake.notify_one();
+          return true;
+        }
+
+        // [FULL] Drop record
+        if (Policy == OverflowPolicy::Drop)
+        {
+          ++Dropped;
+          return false;
+        }
+
+        // [FULL] Wait for buffers to be swapped
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (Closing)
+        {
+          ++Dropped;
+          return false;
+        }
+        ++Stalls;
+        Wake.notify_one();
+        Swapped.wait(lock, [&] { return (Front.load() >> 32) != (front >> 32) || Closing; });
+        front = Front.load(std::memory_order_acquire);
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogQueue::run
+    //! Flush thread procedure
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void run()
+    {
+      for (bool closing = false; !closing; )
+      {
+        uint64_t barrier;
+        {
+          // Sleep until woken, or the interval elapses
+          std::unique_lock<std::mutex> lock(Mutex);
+          Wake.wait_for(lock, Interval, [&] { return Closing || Requested != Completed
+                                                  || static_cast<uint32_t>(Front.load()) >= Capacity / 2; });
+          closing = Closing;
+          barrier = Requested;
+        }
+
+        // Swap buffers; the back buffer was emptied by the previous cycle. The final swap also prevents further reservations.
+        uint64_t front = Front.load(std::memory_order_acquire);
+        while (!Front.compare_exchange_weak(front, ((front & IndexBit) ^ IndexBit) | (closing ? ClosedBit : 0), std::memory_order_acq_rel, std::memory_order_acquire))
+        {}
+        Swapped.notify_all();
+
+        // Wait for writers that reserved space in the old front buffer to publish it
+        Buffer& buffer = Buffers[front >> 32];
+        const uint32_t length = static_cast<uint32_t>(front);
+        while (buffer.Published.load(std::memory_order_acquire) != length)
+          std::this_thread::yield();
+
+        // Pass records to the sink
+        auto started = clock_t::now();
+        uint64_t records = 0;
+        for (uint32_t pos = 0; pos < length; ++records)
+        {
+          RecordHeader header;
+          std::memcpy(&header, &buffer.Data[pos], sizeof(header));
+          Sink(header.Attributes, &buffer.Data[pos + sizeof(header)], header.Length);
+          pos += sizeof(header) + header.Length;
+        }
+        if (length || barrier != Completed)
+          Flusher();
+        auto finished = clock_t::now();
+
+        // Update statistics, then release barriers
+        {
+          std::lock_guard<std::mutex> lock(Mutex);
+          if (length)
+          {
+            auto elapsed = std::chrono::duration_cast<LogStatistics::duration_t>(finished - started);
+            auto latency = std::chrono::duration_cast<LogStatistics::duration_t>(finished - clock_t::time_point(clock_t::duration(buffer.FirstRecord.load())));
+            Statistics.Records += records;
+            Statistics.Bytes += length - records * sizeof(RecordHeader);
+            Statistics.Flushes++;
+            Statistics.FlushTime += elapsed;
+            Statistics.MaxFlushLatency = std::max(Statistics.MaxFlushLatency, elapsed);
+            Statistics.MaxRecordLatency = std::max(Statistics.MaxRecordLatency, latency);
+          }
+          Completed = barrier;
+        }
+        Swapped.notify_all();
+
+        // Recycle buffer
+        buffer.Published.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+
+} //namespace wtl
+#endif // WTL_ASYNC_LOG_QUEUE_HPP
@@ -0,0 +1,759 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\BinaryLog.hpp
+//! \brief Provides a deferred-formatting binary log, and a decoder that renders it offline
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_BINARY_LOG_HPP
+#define WTL_BINARY_LOG_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/BinaryReader.hpp>      //!< BinaryReader
+#include <wtl/io/BinaryWriter.hpp>      //!< BinaryWriter
+#include <algorithm>                    //!< std::min, std::max
+#include <chrono>                       //!< std::chrono
+#include <cstdio>                       //!< snprintf
+#include <cstring>                      //!< strlen, strchr
+#include <initializer_list>             //!< std::initializer_list
+#include <map>                          //!< std::map
+#include <string>                       //!< std::string
+#include <type_traits>                  //!< std::decay_t, std::underlying_type_t
+#include <vector>                       //!< std::vector
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \def BINARY_LOG - Writes a message to a binary log without formatting it
+//!
+//! \param[in,out] log - BinaryLogWriter
+//! \param[in] ... - printf-style format string literal, followed by arguments
+//!
+//! \remarks The message is identified by a compile-time hash of its format and argument types, and registered
+//! \remarks during static initialization. The message costs the identifier, a timestamp and the raw argument bytes.
+//////////////////////////////////////////////////////////////////////////////////////////
+#define BINARY_LOG(log, format, ...)                                                            \
+  do {                                                                                          \
+    struct log_site_t { static constexpr const char* value() { return format; } };              \
+    (log).template write<log_site_t>(__VA_ARGS__);                                              \
+  } while (0)
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum LogArgument - Defines the encoding of binary log message arguments
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class LogArgument : uint8_t
+  {
+    Bool,           //!< Single byte
+    Char,           //!< Single byte character
+    Int8, UInt8,    //!< 8-bit integer
+    Int16, UInt16,  //!< 16-bit integer
+    Int32, UInt32,  //!< 32-bit integer
+    Int64, UInt64,  //!< 64-bit integer
+    Float32,        //!< Single precision
+    Float64,        //!< Double precision
+    String,         //!< Varint length followed by characters
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct log_argument - Maps argument types to their binary log encoding
+  //!
+  //! \tparam T - Argument type (decayed)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename = void>
+  struct log_argument
+  {
+    static_assert(std::is_arithmetic<T>::value, "Binary log arguments must be arithmetic, enumerations or strings");
+
+    static constexpr LogArgument value = std::is_floating_point<T>::value ? (sizeof(T) == 4 ? LogArgument::Float32 : LogArgument::Float64)
+                                       : sizeof(T) == 1 ? (std::is_signed<T>::value ? LogArgument::Int8 : LogArgument::UInt8)
+                                       : sizeof(T) == 2 ? (std::is_signed<T>::value ? LogArgument::Int16 : LogArgument::UInt16)
+                                       : sizeof(T) == 4 ? (std::is_signed<T>::value ? LogArgument::Int32 : LogArgument::UInt32)
+                                       :                  (std::is_signed<T>::value ? LogArgument::Int64 : LogArgument::UInt64);
+  };
+
+  //! \struct log_argument<...> - Define specializations for non-numeric types
+  template <> struct log_argument<bool>                 { static constexpr LogArgument value = LogArgument::Bool;   };
+  template <> struct log_argument<char>                 { static constexpr LogArgument value = LogArgument::Char;   };
+  template <> struct log_argument<char*>                { static constexpr LogArgument value = LogArgument::String; };
+  template <> struct log_argument<const char*>          { static constexpr LogArgument value = LogArgument::String; };
+  template <> struct log_argument<std::string>          { static constexpr LogArgument value = LogArgument::String; };
+  template <typename E>
+  struct log_argument<E, std::enable_if_t<std::is_enum<E>::value>> : log_argument<std::underlying_type_t<E>> {};
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::log_hash
+  //! Accumulates a string into a 32-bit FNV-1a hash at compile-time
+  //!
+  //! \param[in] const* str - String
+  //! \param[in] hash - [optional] Hash of preceding input
+  //! \return uint32_t - Hash
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t log_hash(const char* str, uint32_t hash = 2166136261u)
+  {
+    return *str ? log_hash(str + 1, (hash ^ static_cast<uint8_t>(*str)) * 16777619u) : hash;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::log_hash
+  //! Accumulates argument encodings into a 32-bit FNV-1a hash at compile-time
+  //!
+  //! \param[in] hash - Hash of preceding input
+  //! \param[in] arg - First argument encoding
+  //! \param[in] ...args - Remaining argument encodings
+  //! \return uint32_t - Hash
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t log_hash(uint32_t hash)
+  {
+    return hash;
+  }
+
+  template <typename... ARGS>
+  constexpr uint32_t log_hash(uint32_t hash, LogArgument arg, ARGS... args)
+  {
+    return log_hash((hash ^ static_cast<uint8_t>(arg)) * 16777619u, args...);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::log_nonzero
+  //! Maps a zero hash to one, as identifier zero is reserved for dictionary records
+  //!
+  //! \param[in] hash - Hash
+  //! \return uint32_t - Non-zero hash
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t log_nonzero(uint32_t hash)
+  {
+    return hash ? hash : 1;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::log_format_id
+  //! Computes the identifier of a message at compile-time from its format string and argument encodings
+  //!
+  //! \tparam ARGS... - Argument encoding types
+  //!
+  //! \param[in] const* format - Format string
+  //! \param[in] ...args - Argument encodings
+  //! \return uint32_t - Non-zero identifier  (Zero is reserved for dictionary records)
+  //!
+  //! \remarks Call-sites sharing a format string but passing different argument types require distinct identifiers
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename... ARGS>
+  constexpr uint32_t log_format_id(const char* format, ARGS... args)
+  {
+    return log_nonzero(log_hash(log_hash(format), args...));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LogFormat - Describes a registered binary log message
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LogFormat
+  {
+    std::string               Format;       //!< printf-style format string
+    std::vector<LogArgument>  Arguments;    //!< Argument encodings
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LogFormatRegistry - Registry of every binary log message format within the process
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LogFormatRegistry
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias collection_t - Formats keyed by identifier
+    using collection_t = std::map<uint32_t, LogFormat>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    collection_t  Formats;      //!< Registered formats
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LogFormatRegistry::instance
+    //! Get the process-wide registry
+    //!
+    //! \return LogFormatRegistry& - Registry
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static LogFormatRegistry& instance()
+    {
+      static LogFormatRegistry  registry;
+      return registry;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LogFormatRegistry::add
+    //! Registers a format
+    //!
+    //! \param[in] id - Format identifier
+    //! \param[in] const* format - Format string
+    //! \param[in] args - Argument encodings
+    //! \return bool - True
+    //!
+    //! \throw wtl::logic_error - Identifier already registered for a different format  (Hash collision)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool add(uint32_t id, const char* format, std::initializer_list<LogArgument> args)
+    {
+      auto entry = Formats.emplace(id, LogFormat { format, args });
+
+      // [COLLISION] Decoding either message with the other's encodings would corrupt the log
+      const LogFormat& existing = entry.first->second;
+      if (!entry.second && (existing.Format != format || !std::equal(args.begin(), args.end(), existing.Arguments.begin(), existing.Arguments.end())))
+        throw wtl::logic_error(HERE, "Binary log format '", format, "' collides with '", existing.Format, "'");
+
+      return true;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct log_site - Registers the format and argument types of a BINARY_LOG call-site during static initialization
+  //!
+  //! \tparam SITE - Call-site type providing the format string
+  //! \tparam ARGS... - Argument types (decayed)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename SITE, typename... ARGS>
+  struct log_site
+  {
+    static constexpr uint32_t  id = log_format_id(SITE::value(), log_argument<ARGS>::value...);      //!< Message identifier
+    static const bool          registered;                            //!< Forces registration
+  };
+
+  template <typename SITE, typename... ARGS>
+  const bool log_site<SITE,ARGS...>::registered = LogFormatRegistry::instance().add(id, SITE::value(), { log_argument<ARGS>::value... });
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BinaryLogHeader - Precedes the records of a binary log
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct BinaryLogHeader
+  {
+    char      Magic[4];       //!< "WTLB"
+    uint32_t  Version;        //!< Format version
+    int64_t   WallClock;      //!< Wall-clock time at creation (100ns since 1601, per FILETIME)
+    int64_t   Ticks;          //!< Timestamp clock at creation
+    int64_t   Numerator,      //!< Timestamp clock period numerator (seconds)
+              Denominator;    //!< Timestamp clock period denominator (seconds)
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BinaryLogWriter - Writes log messages as a format identifier, timestamp and raw argument bytes
+  //!
+  //! \tparam STREAM - Output stream type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct BinaryLogWriter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = BinaryLogWriter<STREAM>;
+
+    //! \alias clock_t - Timestamp clock
+    using clock_t = std::chrono::steady_clock;
+
+    //! \var Version - Format version
+    static constexpr uint32_t Version = 1;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    BinaryWriter<STREAM>  Writer;     //!< Output
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogWriter::BinaryLogWriter
+    //! Create a binary log, writing the header and dictionary of registered formats
+    //!
+    //! \tparam ARGS... - Arguments parameter pack type
+    //!
+    //! \param[in,out] &&... args - Stream constructor arguments
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    BinaryLogWriter(ARGS&&... args) : Writer(std::forward<ARGS>(args)...)
+    {
+      // Relate timestamp clock to wall-clock: offset between Unix & FILETIME epochs is 11644473600 seconds
+      using filetime_t = std::chrono::duration<int64_t, std::ratio<1,10000000>>;
+      const int64_t wallClock = std::chrono::duration_cast<filetime_t>(std::chrono::system_clock::now().time_since_epoch()).count()
+                              + 11644473600LL * 10000000;
+
+      BinaryLogHeader header { {'W','T','L','B'}, Version, wallClock, clock_t::now().time_since_epoch().count(),
+                               clock_t::period::num, clock_t::period::den };
+      Writer.write(header);
+      writeDictionary();
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(BinaryLogWriter);      //!< Cannot be copied
+    ENABLE_MOVE(BinaryLogWriter);       //!< Can be moved
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogWriter::write
+    //! Writes a message. Use the BINARY_LOG macro rather than calling directly.
+    //!
+    //! \tparam SITE - Call-site type providing the format string
+    //! \tparam ARGS... - Argument types
+    //!
+    //! \param[in] const&... args - Arguments
+    //!
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename SITE, typename... ARGS>
+    void write(const ARGS&... args)
+    {
+      using site_t = log_site<SITE, std::decay_t<ARGS>...>;
+      (void)site_t::registered;
+
+      // Write identifier and timestamp, then each argument
+      const uint32_t id = site_t::id;
+      Writer.write(id);
+      Writer.write(clock_t::now().time_since_epoch().count());
+
+      int expand[] = { 0, (writeArgument(args), 0)... };
+      (void)expand;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogWriter::writeDictionary
+    //! Writes every registered format. Necessary only if formats are registered after the log is created,
+    //! eg. by a dynamically loaded module.
+    //!
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void writeDictionary()
+    {
+      const auto& formats = LogFormatRegistry::instance().Formats;
+
+      // Write dictionary as record zero
+      Writer.write(uint32_t(0));
+      Writer.writeVarInt(formats.size());
+      for (const auto& f : formats)
+      {
+        Writer.write(f.first);
+        Writer.writeString(f.second.Format.c_str(), static_cast<uint32_t>(f.second.Format.size()));
+        Writer.writeString(reinterpret_cast<const char*>(f.second.Arguments.data()), static_cast<uint32_t>(f.second.Arguments.size()));
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogWriter::writeArgument
+    //! Writes an argument
+    //!
+    //! \tparam T - Argument type
+    //!
+    //! \param[in] const& arg - Argument
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void writeArgument(const T& arg)
+    {
+      Writer.write(reinterpret_cast<const byte*>(&arg), sizeof(T));
+    }
+
+    void writeArgument(bool arg)
+    {
+      Writer.write(arg);
+    }
+
+    void writeArgument(const char* arg)
+    {
+      Writer.writeString(arg, static_cast<uint32_t>(strlen(arg)));
+    }
+
+    void writeArgument(char* arg)     // Otherwise the template is an identity match, and writes the pointer
+    {
+      writeArgument(static_cast<const char*>(arg));
+    }
+
+    void writeArgument(const std::string& arg)
+    {
+      Writer.writeString(arg.c_str(), static_cast<uint32_t>(arg.size()));
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LogRecord - Decoded binary log message
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LogRecord
+  {
+    uint32_t      Id;           //!< Format identifier
+    int64_t       Time;         //!< Wall-clock time (100ns since 1601, per FILETIME)
+    std::string   Text;         //!< Formatted message
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BinaryLogDecoder - Reads a binary log and renders its messages as text
+  //!
+  //! \tparam STREAM - Input stream type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct BinaryLogDecoder
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = BinaryLogDecoder<STREAM>;
+
+    //! \var MaxWidth - Maximum width or precision supplied by an argument  (Length of the formatting buffer)
+    static constexpr int MaxWidth = 512;
+
+    //! \union ArgumentValue - Holds any decoded argument
+    union ArgumentValue
+    {
+      int64_t   Signed;
+      uint64_t  Unsigned;
+      double    Float;
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    BinaryReader<STREAM>             Reader;         //!< Input
+
+  protected:
+    BinaryLogHeader                  Header;         //!< Log header
+    LogFormatRegistry::collection_t  Formats;        //!< Formats defined by the log
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::BinaryLogDecoder
+    //! Create a decoder and read the log header
+    //!
+    //! \tparam ARGS... - Arguments parameter pack type
+    //!
+    //! \param[in,out] &&... args - Stream constructor arguments
+    //!
+    //! \throw wtl::domain_error - Not a binary log, or unsupported version
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    BinaryLogDecoder(ARGS&&... args) : Reader(std::forward<ARGS>(args)...)
+    {
+      Reader.read(Header);
+
+      if (std::string(Header.Magic, 4) != "WTLB")
+        throw wtl::domain_error(HERE, "Not a binary log");
+      if (Header.Version != BinaryLogWriter<STREAM>::Version)
+        throw wtl::domain_error(HERE, "Unsupported binary log version ", Header.Version);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(BinaryLogDecoder);     //!< Cannot be copied
+    ENABLE_MOVE(BinaryLogDecoder);      //!< Can be moved
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::decode
+    //! Renders each remaining message as a line of text
+    //!
+    //! \tparam WRITER - Text writer type providing write(const char*)  (eg. TextWriter, RichTextWriter, LogFileWriter)
+    //!
+    //! \param[in,out] &w - Output writer
+    //! \return uint32_t - Number of messages rendered
+    //!
+    //! \throw wtl::domain_error - Corrupt log or undefined format
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename WRITER>
+    uint32_t decode(WRITER& w)
+    {
+      LogRecord record;
+      uint32_t count = 0;
+
+      for (; next(record); ++count)
+      {
+        // Prefix time of day, to the millisecond
+        char time[32];
+        int64_t ms = record.Time / 10000;
+        snprintf(time, sizeof(time), "%02d:%02d:%02d.%03d ", int(ms / 3600000 % 24), int(ms / 60000 % 60), int(ms / 1000 % 60), int(ms % 1000));
+
+        w.write(time);
+        w.write(record.Text.c_str());
+        w.write("\n");
+      }
+      return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::next
+    //! Reads and formats the next message
+    //!
+    //! \param[in,out] &record - On output, the message
+    //! \return bool - True if a message was read, false if the log is exhausted or ends with a truncated message
+    //!
+    //! \throw wtl::domain_error - Corrupt log, undefined format, or a final message truncated within or after a string
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool next(LogRecord& record)
+    {
+      for (;;)
+      {
+        // [EXHAUSTED]
+        if (Reader.remaining() < static_cast<typename STREAM::distance_t>(sizeof(uint32_t)))
+          return false;
+
+        Reader.read(record.Id);
+
+        // [DICTIONARY] Merge formats then continue
+        if (record.Id == 0)
+        {
+          readDictionary();
+          continue;
+        }
+
+        // Lookup format
+        auto format = Formats.find(record.Id);
+        if (format == Formats.end())
+          throw wtl::domain_error(HERE, "Undefined binary log format ", record.Id);
+
+        // [TRUNCATED] Ignore a final message cut short, eg. by a crash  (Strings are checked as they're read)
+        uint32_t minimum = sizeof(int64_t);
+        for (LogArgument a : format->second.Arguments)
+          minimum += argumentSize(a);
+        if (Reader.remaining() < static_cast<typename STREAM::distance_t>(minimum))
+          return false;
+
+        // Convert timestamp to wall-clock time
+        int64_t ticks;
+        Reader.read(ticks);
+        record.Time = Header.WallClock + static_cast<int64_t>(static_cast<double>(ticks - Header.Ticks) * Header.Numerator * 10000000 / Header.Denominator);
+
+        record.Text = render(format->second);
+        return true;
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::readDictionary
+    //! Reads a dictionary record
+    //!
+    //! \throw wtl::domain_error - Truncated record
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void readDictionary()
+    {
+      for (uint64_t count = Reader.readVarInt(); count; --count)
+      {
+        uint32_t id;
+        if (Reader.remaining() < static_cast<typename STREAM::distance_t>(sizeof(id)))
+          throw wtl::domain_error(HERE, "Truncated binary log dictionary");
+        Reader.read(id);
+
+        LogFormat f;
+        f.Format = readText().str();
+        auto args = readText();
+        for (char a : args)
+          f.Arguments.push_back(static_cast<LogArgument>(a));
+
+        Formats[id] = std::move(f);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::argumentSize
+    //! Get the minimum encoded length of an argument
+    //!
+    //! \param[in] type - Argument encoding
+    //! \return uint32_t - Length in bytes  (Strings require at least their length prefix)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t argumentSize(LogArgument type)
+    {
+      switch (type)
+      {
+      case LogArgument::Int16:   case LogArgument::UInt16:  return 2;
+      case LogArgument::Int32:   case LogArgument::UInt32:  case LogArgument::Float32:  return 4;
+      case LogArgument::Int64:   case LogArgument::UInt64:  case LogArgument::Float64:  return 8;
+      default:                   return 1;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::isSignedInteger
+    //! Query whether an argument encoding is a signed integer
+    //!
+    //! \param[in] type - Argument encoding
+    //! \return bool - True if signed integer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool isSignedInteger(LogArgument type)
+    {
+      return type == LogArgument::Char || type == LogArgument::Int8 || type == LogArgument::Int16 
+          || type == LogArgument::Int32 || type == LogArgument::Int64;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::readText
+    //! Reads a string argument
+    //!
+    //! \return StreamView<char> - View of characters, valid until the next read
+    //!
+    //! \throw wtl::domain_error - Truncated string
+    /////////////////////////////////////////////////////////////////////////////////////////
+    StreamView<char> readText()
+    {
+      uint64_t length = Reader.readVarInt();
+
+      if (length > static_cast<uint64_t>(Reader.remaining()))
+        throw wtl::domain_error(HERE, "Truncated binary log string");
+
+      return Reader.template read_span<char>(static_cast<uint32_t>(length));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::readWidth
+    //! Reads the argument supplying a '*' width or precision
+    //!
+    //! \param[in] type - Argument encoding
+    //! \return int - Value, limited to the length of the formatting buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int readWidth(LogArgument type)
+    {
+      int64_t value;
+      if (type == LogArgument::String)
+      {
+        readText();
+        value = 0;
+      }
+      else if (type == LogArgument::Float32 || type == LogArgument::Float64)
+        value = static_cast<int64_t>(readArgument(type).Float);
+      else if (isSignedInteger(type))
+        value = readArgument(type).Signed;
+      else
+        value = static_cast<int64_t>(std::min<uint64_t>(readArgument(type).Unsigned, MaxWidth));
+
+      return static_cast<int>(std::max<int64_t>(-MaxWidth, std::min<int64_t>(MaxWidth, value)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::readArgument
+    //! Reads a numeric argument
+    //!
+    //! \param[in] type - Argument encoding
+    //! \return ArgumentValue - Value, widened
+    //!
+    //! \throw wtl::domain_error - Truncated argument or unknown encoding
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ArgumentValue readArgument(LogArgument type)
+    {
+      // Messages with string arguments can only be checked as they're read
+      if (Reader.remaining() < static_cast<typename STREAM::distance_t>(argumentSize(type)))
+        throw wtl::domain_error(HERE, "Truncated binary log argument");
+
+      ArgumentValue v;
+      switch (type)
+      {
+      case LogArgument::Bool:    { uint8_t  x; Reader.read(x); v.Unsigned = x;  break; }
+      case LogArgument::Char:    { char     x; Reader.read(x); v.Signed = x;    break; }
+      case LogArgument::Int8:    { int8_t   x; Reader.read(x); v.Signed = x;    break; }
+      case LogArgument::UInt8:   { uint8_t  x; Reader.read(x); v.Unsigned = x;  break; }
+      case LogArgument::Int16:   { int16_t  x; Reader.read(x); v.Signed = x;    break; }
+      case LogArgument::UInt16:  { uint16_t x; Reader.read(x); v.Unsigned = x;  break; }
+      case LogArgument::Int32:   { int32_t  x; Reader.read(x); v.Signed = x;    break; }
+      case LogArgument::UInt32:  { uint32_t x; Reader.read(x); v.Unsigned = x;  break; }
+      case LogArgument::Int64:   { int64_t  x; Reader.read(x); v.Signed = x;    break; }
+      case LogArgument::UInt64:  { uint64_t x; Reader.read(x); v.Unsigned = x;  break; }
+      case LogArgument::Float32: { float    x; Reader.read(x); v.Float = x;     break; }
+      case LogArgument::Float64: { double   x; Reader.read(x); v.Float = x;     break; }
+      default:
+        throw wtl::domain_error(HERE, "Corrupt binary log argument type ", static_cast<int>(type));
+      }
+      return v;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryLogDecoder::render
+    //! Reads the arguments of a message and formats them
+    //!
+    //! \param[in] const& f - Message format
+    //! \return std::string - Formatted message
+    //!
+    //! \throw wtl::domain_error - Corrupt log
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::string render(const LogFormat& f)
+    {
+      std::string out;
+      char buffer[MaxWidth];
+      auto arg = f.Arguments.begin();
+
+      for (const char* pos = f.Format.c_str(); *pos; ++pos)
+      {
+        // Copy literal text
+        if (*pos != '%' || pos[1] == '%')
+        {
+          out += *pos;
+          pos += (*pos == '%');
+          continue;
+        }
+
+        // Extract flags, width & precision, consuming an argument for each '*', and dropping any length modifiers
+        std::string spec(1, '%');
+        for (++pos; *pos && strchr("-+ #0123456789.*", *pos); ++pos)
+          if (*pos != '*' || arg == f.Arguments.end())
+            spec += *pos;
+          else
+          {
+            // Negative widths left-justify; negative precisions are ignored
+            int value = readWidth(*arg++);
+            if (value < 0 && spec.back() == '.')
+              spec.pop_back();
+            else
+              spec += std::to_string(value);
+          }
+        while (*pos && strchr("hljztL", *pos))
+          ++pos;
+
+        // [UNMATCHED] Render remaining specifiers verbatim
+        if (!*pos || arg == f.Arguments.end())
+        {
+          out += spec;
+          if (!*pos)
+            break;
+          out += *pos;
+          continue;
+        }
+
+        // Format argument according to its encoding, which determines the length modifier. The conversion is
+        // honoured only where compatible with the encoding.
+        const LogArgument type = *arg++;
+        const char conversion = *pos;
+        int length;
+        if (type == LogArgument::String)
+        {
+          std::string s = readText().str();
+          length = snprintf(buffer, sizeof(buffer), (spec + 's').c_str(), s.c_str());
+        }
+        else if (type == LogArgument::Float32 || type == LogArgument::Float64)
+        {
+          spec += strchr("fFeEgGaA", conversion) ? conversion : 'g';
+          length = snprintf(buffer, sizeof(buffer), spec.c_str(), readArgument(type).Float);
+        }
+        else if (conversion == 'c')
+          length = snprintf(buffer, sizeof(buffer), (spec + 'c').c_str(), static_cast<int>(readArgument(type).Signed));
+        else 
+        {
+          const bool isSigned = isSignedInteger(type);
+          spec += "ll";
+          spec += strchr("diouxX", conversion) ? conversion : (isSigned ? 'd' : 'u');
+          ArgumentValue v = readArgument(type);
+          length = isSigned ? snprintf(buffer, sizeof(buffer), spec.c_str(), static_cast<long long>(v.Signed))
+                            : snprintf(buffer, sizeof(buffer), spec.c_str(), static_cast<unsigned long long>(v.Unsigned));
+        }
+        out.append(buffer, std::min<size_t>(std::max(length, 0), sizeof(buffer) - 1));
+      }
+
+      // Consume any arguments without specifiers
+      for (; arg != f.Arguments.end(); ++arg)
+        if (*arg == LogArgument::String)
+          readText();
+        else
+          readArgument(*arg);
+
+      return out;
+    }
+  };
+
+} //namespace wtl
+#endif // WTL_BINARY_LOG_HPP
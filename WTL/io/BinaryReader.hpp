@@ -10,6 +10,11 @@
 #define WTL_BINARY_READER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/io/VarInt.hpp>          //!< VarInt, DeltaEncoded
+#include <wtl/io/StreamView.hpp>      //!< StreamView
+#include <cstddef>                    //!< std::max_align_t
+#include <cstring>                    //!< std::memcpy
+#include <vector>                     //!< std::vector
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -19,6 +24,11 @@ namespace wtl
 	//! \struct BinaryReader - Decodes objects from an input stream stored as binary 
   //! 
   //! \tparam STREAM - Input stream type
+  //!
+  //! \remarks Views returned by read_span(), read_view() and readString() are released upon the next read, which
+  //! \remarks  may refill and relocate the stream buffer, so they remain valid until the next read only. Refills
+  //! \remarks  requested directly from the stream (eg. SocketInputStream::fill) also invalidate them, and must 
+  //! \remarks  be sized using remaining() of the reader, which excludes elements awaiting release.
   //////////////////////////////////////////////////////////////////////////////////////////
   template <typename STREAM>
   struct BinaryReader 
@@ -51,7 +61,7 @@ namespace wtl
     //! \param[in,out] &&... args - Stream constructor arguments
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename... ARGS> explicit
-    BinaryReader(ARGS&&... args) : Stream(std::forward<ARGS>(args)...)
+    BinaryReader(ARGS&&... args) : Stream(std::forward<ARGS>(args)...), Unreleased(0)
     {}
     
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
@@ -63,6 +73,20 @@ namespace wtl
 	  // ----------------------------------- STATIC METHODS -----------------------------------
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::remaining() const
+    //! Get the number of unread elements remaining in the stream 
+    //! 
+    //! \return distance_t - Number of unread elements remaining in the stream buffer 
+    //! 
+    //! \throw wtl::logic_error - [Debug only] Stream has been closed
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return Stream.remaining() - static_cast<distance_t>(Unreleased);
+    }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   
@@ -79,10 +103,13 @@ namespace wtl
     template <typename T>
     void read(T& obj)
     {
+      settle();
       CHECKED_LENGTH(sizeof(T), Stream.remaining());
 
       // Read from stream directly into object
+      const element_t* next = Stream.buffer() + sizeof(T);
       Stream.read(reinterpret_cast<byte*>(&obj), sizeof(T));
+      track(next);
 
       // Copy-reconstruct object and advance position
       /*static_alloc<T>::reconstruct(&obj, Stream.buffer());
@@ -101,10 +128,13 @@ namespace wtl
     template <>
     void read<bool>(bool& b)
     {
+      settle();
       CHECKED_LENGTH(1, Stream.remaining());
 
       // Decode from 1 or 0
+      const element_t* next = Stream.buffer() + 1;
       b = Stream.get() == static_cast<element_t>(0x01);
+      track(next);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -121,15 +151,218 @@ namespace wtl
     template <unsigned LENGTH>
     void read(element_t (&arr)[LENGTH])
     {
+      settle();
       CHECKED_LENGTH(LENGTH * sizeof(element_t), Stream.remaining());
 
       // Read directly into elements from stream
+      const element_t* next = Stream.buffer() + LENGTH;
       Stream.read(arr);
+      track(next);
     }
     
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::read
+    //! Reads a buffer of bytes from the input stream verbatim
+    //! 
+    //! \param[in,out] *buf - Buffer
+    //! \param[in] length - Number of bytes to read
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::logic_error - [Debug only] Stream has been closed
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void read(byte* buf, uint32_t length)
+    {
+      settle();
+      CHECKED_LENGTH(length, Stream.remaining());
+
+      // Read directly from stream
+      const element_t* next = Stream.buffer() + length;
+      Stream.read(buf, length);
+      track(next);
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::readVarInt
+    //! Reads an LEB128 varint directly from the stream buffer
+    //! 
+    //! \return uint64_t - Decoded value  (Signed values must be zigzag decoded by the caller)
+    //! 
+    //! \throw wtl::domain_error - Varint is truncated or exceeds 64 bits
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t readVarInt()
+    {
+      settle();
+
+      const byte* pos = reinterpret_cast<const byte*>(Stream.buffer());
+      uint64_t    value;
+
+      // Decode in-place
+      uint32_t length = varint_decode(pos, pos + Stream.remaining(), value);
+      
+      // Release stream, advancing beyond encoding
+      consume(length);
+
+      if (!length)
+        throw wtl::domain_error(HERE, "Malformed varint");
+      
+      return value;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::readVarInts
+    //! Reads a run of consecutive varints directly from the stream buffer
+    //! 
+    //! \tparam T - Integral element type  (Signed types are zigzag decoded)
+    //!
+    //! \param[in,out] *output - Output array 
+    //! \param[in] count - Number of elements to read
+    //! 
+    //! \throw wtl::domain_error - Varint is truncated or exceeds 64 bits
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void readVarInts(T* output, uint32_t count)
+    {
+      settle();
+
+      const byte* pos = reinterpret_cast<const byte*>(Stream.buffer());
+
+      // Decode in-place
+      uint32_t length = varint_decode_run(pos, pos + Stream.remaining(), output, count);
+      
+      // Release stream, advancing beyond encodings
+      consume(length);
+
+      if (!length && count)
+        throw wtl::domain_error(HERE, "Malformed varint");
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::read_span
+    //! Reads an array of objects without copying them, by returning a view of the stream buffer
+    //! 
+    //! \tparam T - Trivially copyable element type
+    //! 
+    //! \param[in] count - Number of elements
+    //! \return StreamView<T> - View of elements within the stream buffer, valid until the next read
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //!
+    //! \remarks The elements are released upon the next read, since releasing may refill and relocate the stream
+    //! \remarks  buffer (eg. LzInputStream). Views that survive a relocation are invalidated. Elements that are 
+    //! \remarks  misaligned within the stream buffer are copied into an internal buffer, which the next read reuses.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    StreamView<T> read_span(uint32_t count)
+    {
+      static_assert(std::is_trivially_copyable<T>::value, "Views can only be created for trivially copyable types");
+      settle();
+      
+      CHECKED_LENGTH(count * sizeof(T), Stream.remaining());
+
+      // Defer release of the elements until the next read
+      const element_t* pos = Stream.buffer();
+      Unreleased = count * sizeof(T);
+
+      // [ALIGNED] Alias elements in-place
+      if (reinterpret_cast<uintptr_t>(pos) % alignof(T) == 0)
+        return StreamView<T>(reinterpret_cast<const T*>(pos), count, Views);
+
+      // [MISALIGNED] Copy elements into aligned storage
+      Copies.invalidate();
+      Aligned.resize((Unreleased + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+      std::memcpy(Aligned.data(), pos, Unreleased);
+      return StreamView<T>(reinterpret_cast<const T*>(Aligned.data()), count, Copies);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::read_view
+    //! Reads a run of stream elements without copying them, by returning a view of the stream buffer
+    //! 
+    //! \param[in] length - Number of elements
+    //! \return StreamView<element_t> - View of elements within the stream buffer, valid until the next read
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    StreamView<element_t> read_view(uint32_t length)
+    {
+      return read_span<element_t>(length);
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::readString
+    //! Reads a string prefixed by its varint length without copying it, by returning a view of the stream buffer
+    //! 
+    //! \tparam CHAR - [optional] Character type  (Default is char)
+    //! 
+    //! \return StreamView<CHAR> - View of characters within the stream buffer, valid until the next read. This is not null terminated.
+    //! 
+    //! \throw wtl::domain_error - Length is truncated or exceeds 64 bits
+    //! \throw wtl::length_error - Length exceeds remaining stream buffer
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHAR = char>
+    StreamView<CHAR> readString()
+    {
+      uint64_t length = readVarInt();
+
+      // Untrusted input: Validate length in all builds
+      if (length > Stream.remaining() / sizeof(CHAR))
+        throw wtl::length_error(HERE, "String length ", length, " exceeds remaining stream buffer");
+
+      return read_span<CHAR>(static_cast<uint32_t>(length));
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::settle
+    //! Releases elements viewed in-place by the last call to 'read_span', before the stream is read again
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void settle()
+    {
+      if (Unreleased)
+      {
+        consume(Unreleased);
+        Unreleased = 0;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::consume
+    //! Releases elements from the stream, invalidating existing views if the stream buffer is relocated
+    //!
+    //! \param[in] length - Number of elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void consume(uint32_t length)
+    {
+      const element_t* next = Stream.buffer() + length;
+      Stream.release(length);
+      track(next);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryReader::track
+    //! Invalidates existing views if reading relocated the unread elements of the stream buffer
+    //!
+    //! \param[in] const* next - Expected position of the next unread element
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void track(const element_t* next)
+    {
+      if (Stream.buffer() != next)
+        Views.invalidate();
+    }
+
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
-    stream_t  Stream;     //!< Input stream
+    stream_t                        Stream;       //!< Input stream
+    ViewSource                      Views;        //!< Lifetime of views upon the stream buffer
+    ViewSource                      Copies;       //!< Lifetime of views upon the aligned buffer
+    std::vector<std::max_align_t>   Aligned;      //!< Copy of elements misaligned within the stream buffer
+    uint32_t                        Unreleased;   //!< Length of elements viewed in-place whose release is deferred
   };
   
 
@@ -269,6 +502,93 @@ namespace wtl
   }
 
   
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Reads an integral value encoded as a compact varint from an input stream
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Integral type
+  //!
+  //! \param[in,out] &r - Binary reader
+  //! \param[in] v - Varint wrapper
+  //! \return BinaryReader<STREAM>& : Reference to 'r'
+  //!
+  //! \throw wtl::domain_error - Varint is truncated or exceeds 64 bits
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
+  BinaryReader<STREAM>& operator >> (BinaryReader<STREAM>& r, VarInt<T> v) 
+  {
+    v.Value = from_varint<T>(r.readVarInt());
+    return r;
+  }
+  
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Reads an enumeration value encoded as a compact varint of its underlying type from an input stream
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Enumeration type
+  //!
+  //! \param[in,out] &r - Binary reader
+  //! \param[in] v - Varint wrapper
+  //! \return BinaryReader<STREAM>& : Reference to 'r'
+  //!
+  //! \throw wtl::domain_error - Varint is truncated or exceeds 64 bits
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T, typename = enable_if_enum_t<T>, typename = void>
+  BinaryReader<STREAM>& operator >> (BinaryReader<STREAM>& r, VarInt<T> v) 
+  {
+    v.Value = static_cast<T>(from_varint<std::underlying_type_t<T>>(r.readVarInt()));
+    return r;
+  }
+  
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Appends a sorted sequence of integers encoded as a varint count and varint deltas to a container.
+  //! The container is not cleared before use.
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam CONTAINER - Container type supporting 'emplace_back'
+  //!
+  //! \param[in,out] &r - Binary reader
+  //! \param[in] d - Delta encoding wrapper
+  //! \return BinaryReader<STREAM>& : Reference to 'r'
+  //!
+  //! \throw wtl::domain_error - Varint is truncated or exceeds 64 bits
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename CONTAINER>
+  BinaryReader<STREAM>& operator >> (BinaryReader<STREAM>& r, DeltaEncoded<CONTAINER> d) 
+  {
+    using value_t = typename DeltaEncoded<CONTAINER>::value_t;
+
+    enum { BATCH = 64 };
+    uint64_t deltas[BATCH];       //!< Decoded differences
+    value_t  previous = value_t();
+
+    // Read count
+    uint64_t count = r.readVarInt();
+
+    // Decode differences in batches, exploiting the run decoder for small deltas
+    while (count)
+    {
+      uint32_t batch = static_cast<uint32_t>(count < BATCH ? count : BATCH);
+      r.readVarInts(deltas, batch);
+
+      // Accumulate differences
+      for (uint32_t i = 0; i < batch; ++i)
+      {
+        previous = static_cast<value_t>(static_cast<uint64_t>(previous) + deltas[i]);
+        d.Elements.emplace_back(previous);
+      }
+      count -= batch;
+    }
+
+    return r;
+  }
+  
   //////////////////////////////////////////////////////////////////////////////////////////
   // wtl::operator >>
   //! Read a bitset from an input stream using its binary representation
@@ -10,6 +10,7 @@
 #define WTL_BINARY_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/io/VarInt.hpp>          //!< VarInt, DeltaEncoded
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -122,6 +123,63 @@ namespace wtl
       Stream.write(arr);
     }
     
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter::write
+    //! Writes a buffer of bytes to the output stream verbatim
+    //! 
+    //! \param[in] const* buf - Buffer
+    //! \param[in] length - Number of bytes to write
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::logic_error - [Debug only] Stream has been closed
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void write(const byte* buf, uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      // Write directly into stream 
+      Stream.write(buf, length);
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter::writeVarInt
+    //! Writes an unsigned value to the output stream as an LEB128 varint of 1 to 10 bytes
+    //! 
+    //! \param[in] value - Value (Signed values should be zigzag encoded first)
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::logic_error - [Debug only] Stream has been closed
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void writeVarInt(uint64_t value)
+    {
+      byte buf[VarIntMaxLength];
+
+      // Encode locally then write with a single stream operation
+      write(buf, varint_encode(value, buf));
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter::writeString
+    //! Writes a string prefixed by its varint length, for reading by BinaryReader::readString
+    //! 
+    //! \tparam CHAR - Character type
+    //! 
+    //! \param[in] const* str - String
+    //! \param[in] length - Number of characters, excluding any null terminator
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::logic_error - [Debug only] Stream has been closed
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHAR>
+    void writeString(const CHAR* str, uint32_t length)
+    {
+      writeVarInt(length);
+      write(reinterpret_cast<const byte*>(str), length * sizeof(CHAR));
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // BinaryWriter::write
     //! Writes a boolean to the output stream as a single element containing 0 or 1
@@ -296,6 +354,90 @@ namespace wtl
   }
 
   
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator << 
+  //! Writes an integral or enumeration value to an output stream as a compact varint. 
+  //! Signed values are zigzag encoded so that values of small magnitude remain short.
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Integral or enumeration type
+  //!
+  //! \param[in,out] &w - Binary writer
+  //! \param[in] const& v - Varint wrapper
+  //! \return BinaryWriter<STREAM>& : Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug Only] Insufficient buffer space remaining
+  //! \throw wtl::logic_error - [Debug only] Stream has been closed
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T, typename = std::enable_if_t<std::is_integral<std::remove_const_t<T>>::value>>
+  BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, const VarInt<T>& v) 
+  {
+    w.writeVarInt(to_varint(v.Value));
+    return w;
+  }
+  
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator << 
+  //! Writes an enumeration value to an output stream as a compact varint of its underlying type
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Enumeration type
+  //!
+  //! \param[in,out] &w - Binary writer
+  //! \param[in] const& v - Varint wrapper
+  //! \return BinaryWriter<STREAM>& : Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug Only] Insufficient buffer space remaining
+  //! \throw wtl::logic_error - [Debug only] Stream has been closed
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T, typename = enable_if_enum_t<std::remove_const_t<T>>, typename = void>
+  BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, const VarInt<T>& v) 
+  {
+    w.writeVarInt(to_varint(static_cast<std::underlying_type_t<std::remove_const_t<T>>>(v.Value)));
+    return w;
+  }
+  
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator << 
+  //! Writes a sorted sequence of integers to an output stream as a varint count followed by 
+  //! the varint difference between each element and its predecessor
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam CONTAINER - Container type
+  //!
+  //! \param[in,out] &w - Binary writer
+  //! \param[in] const& d - Delta encoding wrapper
+  //! \return BinaryWriter<STREAM>& : Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug Only] Insufficient buffer space remaining
+  //! \throw wtl::logic_error - [Debug only] Stream has been closed or elements are not sorted
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename CONTAINER>
+  BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, const DeltaEncoded<CONTAINER>& d) 
+  {
+    using value_t = typename DeltaEncoded<CONTAINER>::value_t;
+    
+    // Write count
+    w.writeVarInt(static_cast<uint64_t>(std::distance(std::begin(d.Elements), std::end(d.Elements))));
+
+    // Write differences, the first from zero  (Which may be negative)
+    value_t previous = value_t();
+    bool first = true;
+    for (const value_t& el : d.Elements)
+    {
+      LOGIC_INVARIANT(first || !(el < previous));
+
+      w.writeVarInt(static_cast<uint64_t>(el) - static_cast<uint64_t>(previous));
+      previous = el;
+      first = false;
+    }
+
+    return w;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////
   // wtl::operator << 
   //! Write any bitset to an output stream using its binary representation
@@ -0,0 +1,608 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\ChecksumStream.hpp
+//! \brief Provides stream adapters that protect their content with per-block checksums
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CHECKSUM_STREAM_HPP
+#define WTL_CHECKSUM_STREAM_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Checksum.hpp>     //!< Crc32c, XxHash64
+#include <algorithm>                  //!< std::min
+#include <cstring>                    //!< std::memcpy
+#include <vector>                     //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \var ChecksumStreamMagic - Identifies the start of a checksummed stream
+  constexpr uint32_t ChecksumStreamMagic = 0x314B4357;      // "WCK1"
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::block_checksum
+  //! Calculates the trailer of a block, which covers its length and content and is chained
+  //! to the trailer of the previous block so that missing or reordered blocks are detected
+  //!
+  //! \tparam HASH - Checksum algorithm
+  //!
+  //! \param[in] previous - Trailer of previous block  (Zero for the first block)
+  //! \param[in] const* data - Block content
+  //! \param[in] length - Length of block content, in bytes
+  //! \return HASH::value_type - Trailer
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename HASH>
+  typename HASH::value_type block_checksum(typename HASH::value_type previous, const byte* data, uint32_t length)
+  {
+    HASH hash(previous);
+    hash.update(&length, sizeof(length));
+    hash.update(data, length);
+    return hash.value();
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ChecksumOutputStream - Output stream adapter that appends a checksum trailer to each block of its output
+  //!
+  //! \tparam STREAM - Output stream type with single-byte elements
+  //! \tparam HASH - [optional] Checksum algorithm  (Default is CRC32C)
+  //!
+  //! \remarks Output is written as a header then a sequence of blocks, each holding its length, its content, and
+  //! \remarks  the checksum of both. Every block is full except the last, which marks the end of the stream and may
+  //! \remarks  be empty. Checksums are calculated as each block is written, while it's still in cache.
+  //!
+  //! \remarks The buffer always has at least one block of free space, so writers may write directly into buffer().
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename HASH = Crc32c>
+  struct ChecksumOutputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ChecksumOutputStream<STREAM,HASH>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef typename STREAM::distance_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef typename STREAM::element_t element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef typename STREAM::position_t position_t;
+
+    //! \typedef stream_t - Stream type
+    typedef STREAM stream_t;
+
+    //! \alias checksum_t - Checksum type
+    using checksum_t = typename HASH::value_type;
+
+    static_assert(sizeof(element_t) == 1, "Checksummed streams require single-byte elements");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    stream_t           Stream;       //!< Output stream
+    uint32_t           BlockSize;    //!< Length of each block, in bytes
+    std::vector<byte>  Input;        //!< Pending output
+    uint32_t           Used;         //!< Number of bytes in 'Input'
+    checksum_t         Previous;     //!< Trailer of previous block
+    uint64_t           Blocks;       //!< Number of blocks written
+    bool               Closed;       //!< Whether stream has been closed
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::ChecksumOutputStream
+    //! Create the adapter and write the stream header
+    //!
+    //! \tparam ARGS... - Stream constructor argument types
+    //!
+    //! \param[in] blockSize - Length of each block, in bytes  (Between 64 bytes and 1GB)
+    //! \param[in,out] &&... args - Stream constructor arguments
+    //!
+    //! \throw wtl::invalid_argument - Invalid block size
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    ChecksumOutputStream(uint32_t blockSize, ARGS&&... args)
+      : Stream(std::forward<ARGS>(args)...),
+        BlockSize(blockSize),
+        Used(0),
+        Previous(0),
+        Blocks(0),
+        Closed(false)
+    {
+      if (blockSize < 64 || blockSize > (1u << 30))
+        throw wtl::invalid_argument(HERE, "Block size must be between 64 bytes and 1GB");
+
+      Input.resize(2 * static_cast<size_t>(blockSize));
+
+      const uint32_t header[] = { ChecksumStreamMagic, HASH::Id, blockSize };
+      Stream.write(reinterpret_cast<const element_t*>(header), sizeof(header));
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ChecksumOutputStream);     //!< Cannot be copied
+    ENABLE_MOVE(ChecksumOutputStream);      //!< Can be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::~ChecksumOutputStream
+    //! Closes the stream if necessary, ignoring any errors
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~ChecksumOutputStream()
+    {
+      try
+      {
+        if (!Closed && !Input.empty())
+          close();
+      }
+      catch (...)
+      {}
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::checksum() const
+    //! Get the trailer of the last block written, which covers all preceding blocks
+    //////////////////////////////////////////////////////////////////////////////////////////
+    checksum_t checksum() const
+    {
+      return Previous;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::remaining() const
+    //! Get the number of bytes that can be written before the next block is written
+    //!
+    //! \return distance_t - Free space within buffer  (Always at least one block)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(Input.size() - Used);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::buffer
+    //! Get the position of the free space within the buffer, for writing directly
+    //!
+    //! \return element_t* - Free space of 'remaining()' bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    element_t* buffer()
+    {
+      return reinterpret_cast<element_t*>(Input.data() + Used);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::release
+    //! Commits bytes written directly into the buffer
+    //!
+    //! \param[in] length - Number of bytes written
+    //!
+    //! \throw wtl::length_error - [Debug only] Exceeds free space
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      Used += length;
+      if (Used >= BlockSize)
+        commit();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::put
+    //! Writes a single byte
+    //!
+    //! \param[in] element - Byte
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void put(element_t element)
+    {
+      *buffer() = element;
+      release(1);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::write
+    //! Writes a buffer of bytes
+    //!
+    //! \param[in] const* buf - Buffer
+    //! \param[in] length - Number of bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void write(const ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Checksummed streams require single-byte elements");
+
+      for (uint32_t chunk; length; buf += chunk, length -= chunk)
+      {
+        chunk = std::min<uint32_t>(length, static_cast<uint32_t>(remaining()));
+        std::memcpy(Input.data() + Used, buf, chunk);
+        release(chunk);
+      }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::write
+    //! Writes all elements of statically allocated array
+    //!
+    //! \param[in] const (&)[] arr - Statically allocated array of elements
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void write(const element_t (&arr)[LENGTH])
+    {
+      write(arr, LENGTH);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::flush
+    //! Flushes the output stream. Output not filling a whole block remains buffered.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      Stream.flush();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::close
+    //! Writes the final (partial) block then closes the output stream
+    //!
+    //! \throw wtl::logic_error - Stream has been closed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      if (Closed)
+        throw wtl::logic_error(HERE, "Stream has been closed");
+
+      emit(Input.data(), Used);
+      Used = 0;
+
+      Closed = true;
+      Stream.close();
+    }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::commit
+    //! Writes every whole block then moves any remaining output to the start of the buffer
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void commit()
+    {
+      uint32_t offset = 0;
+      for (; Used - offset >= BlockSize; offset += BlockSize)
+        emit(Input.data() + offset, BlockSize);
+
+      std::memmove(Input.data(), Input.data() + offset, Used - offset);
+      Used -= offset;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumOutputStream::emit
+    //! Writes a block, calculating its trailer
+    //!
+    //! \param[in] const* data - Block content
+    //! \param[in] length - Length of block content, in bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void emit(const byte* data, uint32_t length)
+    {
+      Previous = block_checksum<HASH>(Previous, data, length);
+      ++Blocks;
+
+      Stream.write(reinterpret_cast<const element_t*>(&length), sizeof(length));
+      Stream.write(reinterpret_cast<const element_t*>(data), length);
+      Stream.write(reinterpret_cast<const element_t*>(&Previous), sizeof(Previous));
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ChecksumInputStream - Input stream adapter that verifies the output of ChecksumOutputStream
+  //!
+  //! \tparam STREAM - Input stream type with single-byte elements
+  //! \tparam HASH - [optional] Checksum algorithm  (Default is CRC32C)
+  //!
+  //! \remarks Each block is verified as it's read from the input stream, before any of it can be consumed. Unless
+  //! \remarks  the end of the stream has been reached, at least one block of verified bytes is available from
+  //! \remarks  buffer(). Views of the buffer are invalidated once the next block is read.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename HASH = Crc32c>
+  struct ChecksumInputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ChecksumInputStream<STREAM,HASH>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef typename STREAM::distance_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef typename STREAM::element_t element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef typename STREAM::position_t position_t;
+
+    //! \typedef stream_t - Stream type
+    typedef STREAM stream_t;
+
+    //! \alias checksum_t - Checksum type
+    using checksum_t = typename HASH::value_type;
+
+    static_assert(sizeof(element_t) == 1, "Checksummed streams require single-byte elements");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    stream_t           Stream;       //!< Input stream
+    uint32_t           BlockSize;    //!< Length of each block, in bytes
+    std::vector<byte>  Window;       //!< Verified input
+    uint32_t           Begin,        //!< Position of first unread byte within 'Window'
+                       End;          //!< Position following last verified byte within 'Window'
+    checksum_t         Previous;     //!< Trailer of previous block
+    uint64_t           Blocks;       //!< Number of blocks verified
+    bool               Finished;     //!< Whether the final block has been read
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::ChecksumInputStream
+    //! Create the adapter, read the stream header, and verify the first block
+    //!
+    //! \tparam ARGS... - Stream constructor argument types
+    //!
+    //! \param[in,out] &&... args - Stream constructor arguments
+    //!
+    //! \throw wtl::domain_error - Input is not a checksummed stream using 'HASH', or the first block is corrupt
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    ChecksumInputStream(ARGS&&... args)
+      : Stream(std::forward<ARGS>(args)...),
+        BlockSize(0),
+        Begin(0),
+        End(0),
+        Previous(0),
+        Blocks(0),
+        Finished(false)
+    {
+      uint32_t header[3];
+      receive(header, sizeof(header));
+
+      if (header[0] != ChecksumStreamMagic || header[1] != HASH::Id || header[2] < 64 || header[2] > (1u << 30))
+        throw wtl::domain_error(HERE, "Input is not a checksummed stream using the expected algorithm");
+
+      BlockSize = header[2];
+      Window.resize(2 * static_cast<size_t>(BlockSize));
+      refill();
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ChecksumInputStream);      //!< Cannot be copied
+    ENABLE_MOVE(ChecksumInputStream);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::checksum() const
+    //! Get the trailer of the last block verified, which covers all preceding blocks
+    //////////////////////////////////////////////////////////////////////////////////////////
+    checksum_t checksum() const
+    {
+      return Previous;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::remaining() const
+    //! Get the number of verified bytes available for reading directly
+    //!
+    //! \return distance_t - Unread bytes within the window  (At least one block unless the stream has ended)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(End - Begin);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::buffer
+    //! Get the position of the first unread byte, for reading directly
+    //!
+    //! \return const element_t* - Unread bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    const element_t* buffer() const
+    {
+      return reinterpret_cast<const element_t*>(Window.data() + Begin);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::release
+    //! Consumes bytes read directly from the buffer
+    //!
+    //! \param[in] length - Number of bytes read
+    //!
+    //! \throw wtl::domain_error - Next block is corrupt
+    //! \throw wtl::length_error - [Debug only] Exceeds unread bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      Begin += length;
+      refill();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::get
+    //! Reads a single byte
+    //!
+    //! \return element_t - Byte
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is corrupt
+    //////////////////////////////////////////////////////////////////////////////////////////
+    element_t get()
+    {
+      if (Begin == End)
+        throw wtl::domain_error(HERE, "Checksummed stream has ended");
+
+      element_t element = *buffer();
+      release(1);
+      return element;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::read
+    //! Reads a buffer of bytes, spanning blocks if necessary
+    //!
+    //! \param[in,out] *buf - Buffer
+    //! \param[in] length - Number of bytes
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is corrupt
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void read(ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Checksummed streams require single-byte elements");
+
+      for (uint32_t chunk; length; buf += chunk, length -= chunk)
+      {
+        if (Begin == End)
+          throw wtl::domain_error(HERE, "Checksummed stream has ended");
+
+        chunk = std::min(length, End - Begin);
+        std::memcpy(buf, Window.data() + Begin, chunk);
+        release(chunk);
+      }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::read
+    //! Reads all elements of statically allocated array
+    //!
+    //! \param[in,out] (&)[] arr - Statically allocated array of elements
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is corrupt
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void read(element_t (&arr)[LENGTH])
+    {
+      read(arr, LENGTH);
+    }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::refill
+    //! Reads and verifies the next block once less than a block remains unread
+    //!
+    //! \throw wtl::domain_error - Block is corrupt
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void refill()
+    {
+      if (Finished || End - Begin >= BlockSize)
+        return;
+
+      // Move unread bytes to the start of the window
+      std::memmove(Window.data(), Window.data() + Begin, End - Begin);
+      End -= Begin;
+      Begin = 0;
+
+      uint32_t   length;
+      checksum_t trailer;
+      receive(&length, sizeof(length));
+      if (length > BlockSize)
+        throw wtl::domain_error(HERE, "Checksummed block ", Blocks, " has a corrupt length");
+
+      receive(Window.data() + End, length);
+      receive(&trailer, sizeof(trailer));
+
+      // Verify before exposing content
+      if (trailer != block_checksum<HASH>(Previous, Window.data() + End, length))
+        throw wtl::domain_error(HERE, "Checksummed block ", Blocks, " is corrupt");
+
+      Previous = trailer;
+      ++Blocks;
+      End += length;
+      Finished = length < BlockSize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // ChecksumInputStream::receive
+    //! Reads bytes from the input stream
+    //!
+    //! \param[in,out] *data - Buffer
+    //! \param[in] length - Number of bytes
+    //!
+    //! \throw wtl::domain_error - Input stream is truncated
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void receive(void* data, uint32_t length)
+    {
+      if (Stream.remaining() < static_cast<distance_t>(length))
+        throw wtl::domain_error(HERE, "Checksummed stream is truncated at block ", Blocks);
+
+      Stream.read(reinterpret_cast<element_t*>(data), length);
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::find_corrupt_blocks
+  //! Verifies every block of a checksummed stream held in memory, continuing past corruption
+  //!
+  //! \tparam HASH - [optional] Checksum algorithm  (Default is CRC32C)
+  //!
+  //! \param[in] const* data - Checksummed stream
+  //! \param[in] length - Length of checksummed stream, in bytes
+  //! \return std::vector<uint64_t> - Zero-based indicies of corrupt blocks. When a block length is corrupt the
+  //!                                 remaining blocks cannot be located, so the last index is then of that block.
+  //!
+  //! \throw wtl::domain_error - Input is not a checksummed stream using 'HASH'
+  //!
+  //! \remarks A block's content occupies bytes [index * blockSize, (index+1) * blockSize) of the original output.
+  //! \remarks  As trailers are chained, a corrupt trailer is also reported against the following block.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename HASH = Crc32c>
+  std::vector<uint64_t> find_corrupt_blocks(const byte* data, uint64_t length)
+  {
+    using checksum_t = typename HASH::value_type;
+
+    uint32_t header[3];
+    if (length < sizeof(header))
+      throw wtl::domain_error(HERE, "Input is not a checksummed stream");
+
+    std::memcpy(header, data, sizeof(header));
+    if (header[0] != ChecksumStreamMagic || header[1] != HASH::Id)
+      throw wtl::domain_error(HERE, "Input is not a checksummed stream using the expected algorithm");
+
+    const uint32_t blockSize = header[2];
+    std::vector<uint64_t> corrupt;
+    checksum_t previous = 0;
+
+    for (uint64_t offset = sizeof(header), idx = 0; ; ++idx)
+    {
+      uint32_t block;
+      checksum_t trailer;
+
+      // [TRUNCATED/LENGTH] Unable to locate subsequent blocks
+      if (length - offset < sizeof(block))
+        return corrupt.push_back(idx), corrupt;
+      std::memcpy(&block, data + offset, sizeof(block));
+      if (block > blockSize || length - offset - sizeof(block) < block + sizeof(trailer))
+        return corrupt.push_back(idx), corrupt;
+
+      std::memcpy(&trailer, data + offset + sizeof(block) + block, sizeof(trailer));
+      if (trailer != block_checksum<HASH>(previous, data + offset + sizeof(block), block))
+        corrupt.push_back(idx);
+
+      previous = trailer;
+      offset += sizeof(block) + block + sizeof(trailer);
+
+      // [FINAL] Partial block marks the end
+      if (block < blockSize)
+        return corrupt;
+    }
+  }
+
+} // WTL namespace
+
+#endif // WTL_CHECKSUM_STREAM_HPP
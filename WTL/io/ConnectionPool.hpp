@@ -0,0 +1,665 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\ConnectionPool.hpp
+//! \brief Provides a pool of reusable client connections, keyed by endpoint
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CONNECTION_POOL_HPP
+#define WTL_CONNECTION_POOL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Socket.hpp>                  //!< Socket
+#include <wtl/io/Resolver.hpp>                //!< Resolver
+#include <wtl/io/SocketConnector.hpp>         //!< SocketConnector
+#include <wtl/utils/String.hpp>               //!< String
+#include <algorithm>                          //!< std::find
+#include <chrono>                             //!< std::chrono
+#include <condition_variable>                 //!< std::condition_variable
+#include <deque>                              //!< std::deque
+#include <map>                                //!< std::map
+#include <mutex>                              //!< std::mutex
+#include <string>                             //!< std::string
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PoolLimits - Sizing, expiry and health parameters of a ConnectionPool, applied per endpoint
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct PoolLimits
+  {
+    uint32_t                                  MinIdle = 0;                                  //!< Idle connections retained regardless of age, and restored by 'maintain'
+    uint32_t                                  MaxIdle = 8;                                  //!< Idle connections retained upon release
+    uint32_t                                  MaxConnections = 32;                          //!< Connections open at once, whether leased or idle
+    std::chrono::steady_clock::duration       IdleTimeout = std::chrono::seconds(60);       //!< Age at which 'maintain' closes idle connections
+    std::chrono::steady_clock::duration       ConnectTimeout = std::chrono::seconds(5);     //!< Deadline for opening a connection
+    std::chrono::steady_clock::duration       CheckoutTimeout = std::chrono::seconds(10);   //!< Deadline for waiting upon a connection
+    uint32_t                                  FailureThreshold = 3;                         //!< Consecutive failures that suspend an endpoint
+    std::chrono::steady_clock::duration       Cooldown = std::chrono::seconds(5);           //!< Duration of a suspension
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ConnectionPool - Lends connected stream sockets, reusing them across requests to the same endpoint
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Connections are lent as a Lease, which returns the connection upon destruction. Callers report I/O
+  //! \remarks  errors with Lease::fail(), which closes the connection instead. Consecutive failures, including failed
+  //! \remarks  connects, suspend the endpoint for a cooldown, during which checkouts fail immediately.
+  //! \remarks
+  //! \remarks Once an endpoint reaches its connection limit, callers queue in arrival order and released connections
+  //! \remarks  are handed directly to the longest waiter, so no thread can be starved by others re-acquiring first.
+  //! \remarks  Idle connections are reused most-recent first, leaving the oldest to expire in 'maintain'.
+  //! \remarks
+  //! \remarks The pool must outlive its leases.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct ConnectionPool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ConnectionPool<FAMILY>;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+    //! \alias clock_t - Expiry clock
+    using clock_t = std::chrono::steady_clock;
+
+    //! \struct Statistics - Pool activity, across all endpoints
+    struct Statistics
+    {
+      uint64_t  Created;      //!< Connections opened
+      uint64_t  Reused;       //!< Checkouts satisfied by an existing connection
+      uint64_t  Evicted;      //!< Idle connections closed by age, limit or liveness check
+      uint64_t  Failures;     //!< Failed connects and failed leases
+      uint64_t  Waits;        //!< Checkouts that queued for a connection
+    };
+
+  protected:
+    //! \struct Parked - Idle connection
+    struct Parked
+    {
+      socket_t             Connection;    //!< Connection
+      clock_t::time_point  Since;         //!< Time of release
+    };
+
+    //! \struct Waiter - Checkout queued upon an endpoint at its connection limit
+    struct Waiter
+    {
+      std::condition_variable  Signal;        //!< Signalled when granted
+      socket_t                 Connection;    //!< Connection handed over, or empty if granted a slot in which to connect
+      bool                     Granted;       //!< Whether granted a connection or slot
+    };
+
+    //! \struct Endpoint - Connections to one host and port
+    struct Endpoint
+    {
+      std::string           Host;         //!< Host name or address
+      uint16_t              Port;         //!< Port
+      std::vector<Parked>   Idle;         //!< Idle connections, oldest first
+      std::deque<Waiter*>   Queue;        //!< Queued checkouts, in arrival order
+      uint32_t              Open;         //!< Number of connections open, or being opened
+      uint32_t              Failures;     //!< Number of consecutive failures
+      int32_t               Error;        //!< Error of last failure
+      clock_t::time_point   Suspended;    //!< Time at which suspension ends
+    };
+
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Lease - Connection lent by the pool
+    //////////////////////////////////////////////////////////////////////////////////////////
+    struct Lease
+    {
+      // ----------------------------------- REPRESENTATION -----------------------------------
+    protected:
+      ConnectionPool*  Pool;          //!< Owner  (nullptr once released)
+      Endpoint*        Origin;        //!< Endpoint
+      socket_t         Connection;    //!< Connection
+      bool             Failed;        //!< Whether the connection failed
+
+      // ------------------------------------ CONSTRUCTION ------------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::Lease
+      //! Create lease
+      //!
+      //! \param[in,out] &pool - Owner
+      //! \param[in,out] &origin - Endpoint
+      //! \param[in] const& connection - Connection
+      /////////////////////////////////////////////////////////////////////////////////////////
+      Lease(ConnectionPool& pool, Endpoint& origin, const socket_t& connection)
+        : Pool(&pool), Origin(&origin), Connection(connection), Failed(false)
+      {}
+
+      // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+    public:
+      DISABLE_COPY(Lease);      //!< Cannot be copied
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::Lease
+      //! Move lease
+      /////////////////////////////////////////////////////////////////////////////////////////
+      Lease(Lease&& r) : Pool(r.Pool), Origin(r.Origin), Connection(r.Connection), Failed(r.Failed)
+      {
+        r.Pool = nullptr;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::operator=
+      //! Move-assign lease, returning any connection currently held
+      /////////////////////////////////////////////////////////////////////////////////////////
+      Lease& operator = (Lease&& r)
+      {
+        if (this != &r)
+        {
+          release();
+          Pool = r.Pool;
+          Origin = r.Origin;
+          Connection = r.Connection;
+          Failed = r.Failed;
+          r.Pool = nullptr;
+        }
+        return *this;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::~Lease
+      //! Return the connection to the pool
+      /////////////////////////////////////////////////////////////////////////////////////////
+      ~Lease()
+      {
+        release();
+      }
+
+      // ---------------------------------- ACCESSOR METHODS ----------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::socket
+      //! Get the connection
+      /////////////////////////////////////////////////////////////////////////////////////////
+      socket_t& socket()
+      {
+        return Connection;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::operator->
+      //! Access the connection
+      /////////////////////////////////////////////////////////////////////////////////////////
+      socket_t* operator -> ()
+      {
+        return &Connection;
+      }
+
+      // ----------------------------------- MUTATOR METHODS ----------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::fail
+      //! Report that the connection failed, so it's closed rather than reused
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void fail()
+      {
+        Failed = true;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Lease::release
+      //! Return the connection to the pool early
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void release()
+      {
+        if (ConnectionPool* pool = Pool)
+        {
+          Pool = nullptr;
+          pool->checkin(*Origin, Connection, Failed);
+        }
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                                 Mutex;         //!< Guards endpoints and statistics
+    std::map<std::pair<std::string,uint16_t>,Endpoint> Endpoints;     //!< Endpoints by host and port  (Never erased)
+    SocketConnector<FAMILY>                            Connector;     //!< Opens connections
+    PoolLimits                                         Limits;        //!< Limits
+    Statistics                                         Stats;         //!< Activity
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::ConnectionPool
+    //! Create empty pool
+    //!
+    //! \param[in,out] &resolver - Resolver, which must outlive the pool
+    //! \param[in] const& limits - [optional] Limits applied to each endpoint
+    //!
+    //! \throw wtl::invalid_argument - Maximum connections is zero, or less than minimum idle connections
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ConnectionPool(Resolver<FAMILY>& resolver, const PoolLimits& limits = PoolLimits())
+      : Connector(resolver), Limits(limits), Stats {}
+    {
+      if (!limits.MaxConnections || limits.MaxConnections < limits.MinIdle)
+        throw wtl::invalid_argument(HERE, "Maximum connections must be non-zero and no less than the minimum idle connections");
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ConnectionPool);     //!< Cannot be copied
+    DISABLE_MOVE(ConnectionPool);     //!< Cannot be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::idle const
+    //! Get the number of idle connections to an endpoint
+    //!
+    //! \param[in] const& host - Host name or address
+    //! \param[in] port - Port
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t idle(const String<Encoding::ANSI>& host, uint16_t port) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      auto pos = Endpoints.find(std::make_pair(std::string(host.c_str()), port));
+      return pos != Endpoints.end() ? pos->second.Idle.size() : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::open const
+    //! Get the number of connections open to an endpoint, whether leased or idle
+    //!
+    //! \param[in] const& host - Host name or address
+    //! \param[in] port - Port
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t open(const String<Encoding::ANSI>& host, uint16_t port) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      auto pos = Endpoints.find(std::make_pair(std::string(host.c_str()), port));
+      return pos != Endpoints.end() ? pos->second.Open : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::statistics const
+    //! Get pool activity
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Statistics statistics() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return Stats;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::checkout
+    //! Borrow a connection to an endpoint, reusing an idle connection when available
+    //!
+    //! \param[in] const& host - Host name or address
+    //! \param[in] port - Port (in host byte order)
+    //! \return Lease - Connection, returned to the pool when the lease is destroyed
+    //!
+    //! \throw wtl::socket_error - Endpoint suspended, unable to connect, or timed out waiting (WSAETIMEDOUT)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Lease checkout(const String<Encoding::ANSI>& host, uint16_t port)
+    {
+      const clock_t::time_point deadline = clock_t::now() + Limits.CheckoutTimeout;
+      std::unique_lock<std::mutex> lock(Mutex);
+      Endpoint& e = endpoint(host.c_str(), port);
+
+      for (;;)
+      {
+        suspended(e, lock);
+
+        // [IDLE] Reuse most recent connection that's still alive, unless others are queued ahead
+        if (e.Queue.empty() && !e.Idle.empty())
+        {
+          socket_t c = e.Idle.back().Connection;
+          e.Idle.pop_back();
+
+          lock.unlock();
+          const bool ok = alive(c);
+          lock.lock();
+
+          if (ok)
+          {
+            ++Stats.Reused;
+            return Lease(*this, e, c);
+          }
+
+          // [DEAD] Reconnect within its slot, unless the endpoint was suspended meanwhile
+          ++Stats.Evicted;
+          if (clock_t::now() < e.Suspended)
+          {
+            --e.Open;
+            grant(e);
+            continue;
+          }
+          break;
+        }
+
+        // [CAPACITY] Connect in a free slot
+        if (e.Queue.empty() && e.Open < Limits.MaxConnections)
+        {
+          ++e.Open;
+          break;
+        }
+
+        // [FULL] Queue until handed a connection or a slot
+        Waiter w { {}, socket_t(HSocket()), false };
+        e.Queue.push_back(&w);
+        ++Stats.Waits;
+        handoff(e);
+
+        if (!w.Signal.wait_until(lock, deadline, [&w] { return w.Granted; }))
+        {
+          e.Queue.erase(std::find(e.Queue.begin(), e.Queue.end(), &w));
+          lock.unlock();
+          ::WSASetLastError(WSAETIMEDOUT);
+          throw socket_error(HERE, "Timed out waiting for a connection to " + host);
+        }
+
+        // [CONNECTION] Verify an idle connection is still alive; otherwise reconnect within its slot
+        if (w.Connection.handle().exists())
+        {
+          socket_t c = w.Connection;
+
+          lock.unlock();
+          const bool ok = alive(c);
+          lock.lock();
+
+          if (ok)
+          {
+            ++Stats.Reused;
+            return Lease(*this, e, c);
+          }
+          ++Stats.Evicted;
+        }
+
+        // Granted slot; relinquish it if the endpoint was suspended meanwhile
+        if (clock_t::now() < e.Suspended)
+        {
+          --e.Open;
+          grant(e);
+          continue;
+        }
+        break;
+      }
+
+      // Connect without holding the lock
+      lock.unlock();
+      try
+      {
+        socket_t c = Connector.connect(host, port, Limits.ConnectTimeout);
+        keepalive(c);
+
+        lock.lock();
+        e.Failures = 0;
+        ++Stats.Created;
+        return Lease(*this, e, c);
+      }
+      catch (socket_error&)
+      {
+        const int32_t error = ::WSAGetLastError();
+        std::vector<Parked> closing;
+
+        lock.lock();
+        --e.Open;
+        fail(e, error, closing);
+        grant(e);
+        lock.unlock();
+        ::WSASetLastError(error);
+        throw;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::maintain
+    //! Closes idle connections older than the idle timeout, except the newest 'MinIdle' of each endpoint, then
+    //! opens connections to restore 'MinIdle' at each healthy endpoint
+    //!
+    //! \return uint32_t - Number of connections closed
+    //!
+    //! \remarks Intended to be called periodically, such as from a timer. Connects are attempted sequentially and
+    //! \remarks  failures count towards endpoint health, but aren't thrown.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t maintain()
+    {
+      const clock_t::time_point now = clock_t::now();
+      std::vector<Parked> closing;
+      std::vector<Endpoint*> deficient;
+
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        for (auto& pos : Endpoints)
+        {
+          Endpoint& e = pos.second;
+
+          // Close expired connections beyond the minimum; idle connections are ordered oldest first
+          auto keep = e.Idle.begin();
+          while (keep != e.Idle.end() && e.Idle.end() - keep > static_cast<ptrdiff_t>(Limits.MinIdle) && now - keep->Since >= Limits.IdleTimeout)
+            ++keep;
+
+          closing.insert(closing.end(), e.Idle.begin(), keep);
+          e.Open -= static_cast<uint32_t>(keep - e.Idle.begin());
+          e.Idle.erase(e.Idle.begin(), keep);
+
+          if (e.Idle.size() < Limits.MinIdle && e.Queue.empty() && now >= e.Suspended)
+            deficient.push_back(&e);
+        }
+        Stats.Evicted += closing.size();
+      }
+
+      // Restore minimum idle connections
+      for (Endpoint* e : deficient)
+        for (bool more = true; more; )
+        {
+          {
+            std::lock_guard<std::mutex> lock(Mutex);
+            if ((more = e->Idle.size() < Limits.MinIdle && e->Open < Limits.MaxConnections && clock_t::now() >= e->Suspended))
+              ++e->Open;
+          }
+          if (more)
+            try
+            {
+              socket_t c = Connector.connect(e->Host.c_str(), e->Port, Limits.ConnectTimeout);
+              keepalive(c);
+              {
+                std::lock_guard<std::mutex> lock(Mutex);
+                ++Stats.Created;
+              }
+              checkin(*e, c, false);
+            }
+            catch (socket_error&)
+            {
+              std::vector<Parked> failed;
+              std::lock_guard<std::mutex> lock(Mutex);
+              --e->Open;
+              fail(*e, ::WSAGetLastError(), failed);
+              grant(*e);
+              closing.insert(closing.end(), failed.begin(), failed.end());
+              more = false;
+            }
+        }
+
+      return static_cast<uint32_t>(closing.size());
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::alive
+    //! Query whether an idle connection is still usable
+    //!
+    //! \param[in] const& c - Idle connection
+    //! \return bool - False if the peer closed the connection, or sent data unsolicited
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool alive(const socket_t& c)
+    {
+      ::fd_set readable;
+      ::timeval tv { 0, 0 };
+      FD_ZERO(&readable);
+      FD_SET(c.handle(), &readable);
+
+      // Idle connections should never be readable
+      return ::select(0, &readable, nullptr, nullptr, &tv) == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::checkin
+    //! Accepts a connection returned by a lease
+    //!
+    //! \param[in,out] &e - Endpoint
+    //! \param[in] const& c - Connection
+    //! \param[in] failed - Whether the connection failed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void checkin(Endpoint& e, const socket_t& c, bool failed)
+    {
+      std::vector<Parked> closing;
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      // [FAILED] Close connection and pass its slot to the next waiter
+      if (failed)
+      {
+        --e.Open;
+        fail(e, WSAECONNRESET, closing);
+        grant(e);
+        return;
+      }
+
+      e.Failures = 0;
+
+      // [QUEUED] Hand directly to the longest waiter
+      if (!e.Queue.empty())
+      {
+        Waiter* w = e.Queue.front();
+        e.Queue.pop_front();
+        w->Connection = c;
+        w->Granted = true;
+        w->Signal.notify_one();
+      }
+      // [IDLE] Retain unless idle limit reached
+      else if (e.Idle.size() < Limits.MaxIdle)
+        e.Idle.push_back(Parked { c, clock_t::now() });
+      else
+      {
+        --e.Open;
+        ++Stats.Evicted;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::endpoint
+    //! Get an endpoint, creating it if necessary
+    //!
+    //! \param[in] const& host - Host name or address
+    //! \param[in] port - Port
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Endpoint& endpoint(const std::string& host, uint16_t port)
+    {
+      auto pos = Endpoints.find(std::make_pair(host, port));
+      if (pos == Endpoints.end())
+        pos = Endpoints.emplace(std::make_pair(host, port), Endpoint { host, port, {}, {}, 0, 0, 0, clock_t::time_point() }).first;
+      return pos->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::fail
+    //! Records a failure, suspending the endpoint and closing its idle connections at the threshold
+    //!
+    //! \param[in,out] &e - Endpoint
+    //! \param[in] error - Error
+    //! \param[in,out] &closing - Receives idle connections to close once the lock is released
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void fail(Endpoint& e, int32_t error, std::vector<Parked>& closing)
+    {
+      ++Stats.Failures;
+      e.Error = error;
+
+      if (++e.Failures >= Limits.FailureThreshold)
+      {
+        e.Failures = 0;
+        e.Suspended = clock_t::now() + Limits.Cooldown;
+
+        // Idle connections to a failing endpoint are suspect
+        Stats.Evicted += e.Idle.size();
+        e.Open -= static_cast<uint32_t>(e.Idle.size());
+        closing.swap(e.Idle);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::grant
+    //! Passes a free slot to the longest waiter, which then connects
+    //!
+    //! \param[in,out] &e - Endpoint
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void grant(Endpoint& e)
+    {
+      if (!e.Queue.empty() && e.Open < Limits.MaxConnections)
+      {
+        Waiter* w = e.Queue.front();
+        e.Queue.pop_front();
+        ++e.Open;
+        w->Granted = true;
+        w->Signal.notify_one();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::handoff
+    //! Passes idle connections to waiters, longest waiter first, who verify them before use
+    //!
+    //! \param[in,out] &e - Endpoint
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void handoff(Endpoint& e)
+    {
+      while (!e.Queue.empty() && !e.Idle.empty())
+      {
+        Waiter* w = e.Queue.front();
+        e.Queue.pop_front();
+        w->Connection = e.Idle.back().Connection;
+        e.Idle.pop_back();
+        w->Granted = true;
+        w->Signal.notify_one();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::keepalive
+    //! Enables TCP keep-alive probes, so connections to vanished peers are eventually detected while idle
+    //!
+    //! \param[in,out] &c - Connection
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void keepalive(socket_t& c)
+    {
+      ::BOOL enable = TRUE;
+      ::setsockopt(c.handle(), SOL_SOCKET, SO_KEEPALIVE, reinterpret_cast<const char*>(&enable), sizeof(enable));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConnectionPool::suspended
+    //! Fails a checkout while the endpoint is suspended
+    //!
+    //! \param[in] const& e - Endpoint
+    //! \param[in,out] &lock - Lock upon pool, released before throwing
+    //!
+    //! \throw wtl::socket_error - Endpoint suspended  (Reports the error of the last failure)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void suspended(const Endpoint& e, std::unique_lock<std::mutex>& lock)
+    {
+      if (clock_t::now() < e.Suspended)
+      {
+        const int32_t error = e.Error;
+        const std::string host = e.Host;
+        lock.unlock();
+        ::WSASetLastError(error);
+        throw socket_error(HERE, "Connections to " + host + " suspended after repeated failures");
+      }
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_CONNECTION_POOL_HPP
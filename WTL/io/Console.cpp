@@ -13,6 +13,7 @@
 namespace wtl
 {
   
+#ifdef _WIN32
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \struct console_window - Allocates a process-wide console
   //////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +61,7 @@ namespace wtl
   //! \var cwindow - Allocates process console
   //////////////////////////////////////////////////////////////////////////////////////////
   console_window cwindow;
+#endif
 
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \var cdebug - Narrow character debug console stream
@@ -2,7 +2,8 @@
 //! \file wtl\io\Console.hpp
 //! \brief Contains the buffer, manipulators, traits, and stream type for a custom output stream  
 //! \brief  that supports writing formatted coloured text to stdout through the Win32 console API 
-//! \brief  using the existing stream manipulators provided by the standard library.
+//! \brief  using the existing stream manipulators provided by the standard library. Colour changes
+//! \brief  are applied through either the Win32 console API or inline VT escape sequences.
 //! \date 28 November 2015
 //! \author Nick Crowley
 //! \copyright Nick Crowley. All rights reserved.
@@ -15,14 +16,61 @@
 #include <deque>                      //!< std::deque
 #include <sstream>                    //!< std::basic_stringstream
 #include <ios>                        //!< std::ios_base
-#include <WTL/utils/Point.hpp>        //!< Point
-#include <WTL/utils/exception.hpp>    //!< caught-exception
+#include <algorithm>                  //!< std::copy
+#include <cstdio>                     //!< std::snprintf
+#include <cstdlib>                    //!< std::abs
+#include <cerrno>                     //!< errno
+#include <functional>                 //!< std::function
+#include <locale>                     //!< std::num_put
+#include <cstdint>                    //!< uint16_t, uint32_t
+#ifdef _WIN32
+#  include <wtl/utils/Point.hpp>      //!< Point
+#  include <wtl/utils/Exception.hpp>  //!< caught_exception
+#else
+#  include <unistd.h>                 //!< ::write
+#endif
+
+#ifdef _WIN32
+#  ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#    define ENABLE_VIRTUAL_TERMINAL_PROCESSING  0x0004    //!< Missing from older SDKs
+#  endif
+#else
+//! Text attributes using the bit layout of the Win32 console API, for the textcol/backcol manipulators
+#  define FOREGROUND_BLUE         0x0001
+#  define FOREGROUND_GREEN        0x0002
+#  define FOREGROUND_RED          0x0004
+#  define FOREGROUND_INTENSITY    0x0008
+#  define BACKGROUND_BLUE         0x0010
+#  define BACKGROUND_GREEN        0x0020
+#  define BACKGROUND_RED          0x0040
+#  define BACKGROUND_INTENSITY    0x0080
+#endif
 
 //////////////////////////////////////////////////////////////////////////////////////////
 //! \namespace wtl - Windows template library
 //////////////////////////////////////////////////////////////////////////////////////////
 namespace wtl
 {
+#ifndef _WIN32
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Point - Screen co-ordinate used off Windows, where the library point type is unavailable 
+  //!
+  //! \tparam T - Dimension type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct Point
+  {
+    T  X,       //!< X co-ordinate
+       Y;       //!< Y co-ordinate
+
+    constexpr Point(T x = 0, T y = 0) : X(x), Y(y)
+    {}
+
+    bool operator==(const Point& r) const  { return X == r.X && Y == r.Y; }
+    bool operator!=(const Point& r) const  { return !(*this == r);        }
+  };
+#endif
+
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \struct console_traits - Traits type for the debug-console stream providing a custom stream position type
   //! 
@@ -114,13 +162,37 @@ namespace wtl
 
 
   //////////////////////////////////////////////////////////////////////////////////////////
-  //! \struct console_streambuf - Custom debug-console stream buffer 
-  //! 
+  //! \enum ConsoleBackend - Defines how a debug-console applies colour changes
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class ConsoleBackend
+  {
+    Automatic,          //!< Use VT escape sequences where the console supports them, otherwise the Win32 console API
+    Win32,              //!< Flush and call SetConsoleTextAttribute() upon each colour change  [Windows only]
+    VirtualTerminal,    //!< Write VT/ANSI escape sequences inline into the output buffer
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum ConsoleOutput - Defines the standard device written by a debug-console
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class ConsoleOutput
+  {
+    StdOut,             //!< Standard output
+    StdErr,             //!< Standard error
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct console_streambuf - Custom debug-console stream buffer
+  //!
   //! \tparam CHAR - Character type
   //! \tparam TRAITS - [optional] Type providing character traits
-  //! 
-  //! \remarks Provides a custom stream buffer for the debug-console stream, enabling buffered output, 
+  //!
+  //! \remarks Provides a custom stream buffer for the debug-console stream, enabling buffered output,
   //! \remarks  custom positioning, and handling of foreground/background colour attributes
+  //!
+  //! \remarks The current attributes are cached so redundant colour changes cost nothing. The VT backend
+  //! \remarks  writes colour changes into the 'put area' as SGR sequences, so the buffer is only flushed
+  //! \remarks  when full or synchronized; consecutive changes with no text between them collapse into one.
   //////////////////////////////////////////////////////////////////////////////////////////
   template <typename CHAR, typename TRAITS = console_traits<CHAR>>
   struct console_streambuf : std::basic_streambuf<CHAR,TRAITS>
@@ -138,7 +210,7 @@ namespace wtl
 
     //! \alias int_type - Inherit integer representation type
     using int_type = typename base::int_type;
-  
+
     //! \alias openmode - Inherit stream open mode
     using openmode = std::ios_base::openmode;
 
@@ -147,51 +219,107 @@ namespace wtl
 
     //! \alias pos_type - Inherit position type
     using pos_type = typename base::pos_type;
-  
+
     //! \alias seekdir - Inherit seek direction
     using seekdir = std::ios_base::seekdir;
-  
+
     //! \alias traits_type - Inherit traits type
     using traits_type = typename base::traits_type;
 
+#ifdef _WIN32
+    //! \alias handle_t - Output device handle
+    using handle_t = ::HANDLE;
+#else
+    //! \alias handle_t - Output file descriptor
+    using handle_t = int;
+#endif
+
+    //! \alias device_t - Custom output device, receiving the contents of the put area upon each flush
+    using device_t = std::function<bool (const char_type*, uint32_t)>;
+
   private:
     static const uint16_t  BackgroundMask = 0x00f0,     //!< Background text attributes mask
-                           ForegroundMask = 0x000f;     //!< Foreground text attributes mask
+                           ForegroundMask = 0x000f,     //!< Foreground text attributes mask
+                           NoAttributes = 0xffff,       //!< Sentinel for unknown terminal attributes
+                           DefaultAttributes = FOREGROUND_RED|FOREGROUND_GREEN|FOREGROUND_BLUE;   //!< White text upon black
+
+    static const uint32_t  MaxSequence = 16;            //!< Longest escape sequence written into the put area
 
     // ----------------------------------- REPRESENTATION -----------------------------------
   private:
-    std::vector<char_type>  Buffer;       //!< Buffer 'put area'  
-    ::HANDLE                Handle;       //!< console_stream handle
-    std::deque<uint16_t>    Stack;        //!< Formatting stack
+    std::vector<char_type>  Buffer;                     //!< Buffer 'put area'
+    handle_t                Handle;                     //!< console_stream handle
+    std::deque<uint16_t>    Stack;                      //!< Formatting stack
+    ConsoleBackend          Backend;                    //!< Backend used for colour changes
+    uint16_t                Attributes = NoAttributes;  //!< Current text attributes
+    uint16_t                Previous = NoAttributes;    //!< [VT] Attributes in effect before the trailing escape sequence
+    char_type*              Escape = nullptr;           //!< [VT] Start of the trailing escape sequence, if any
+    char_type*              EscapeEnd = nullptr;        //!< [VT] End of the trailing escape sequence, if any
+    device_t                Device;                     //!< [Optional] Custom output device
 
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::console_streambuf
-    //! Construct debug-console buffer 
-    //! 
+    //! Construct debug-console buffer
+    //!
     //! \param[in] len - [optional] Length of buffer (in characters)
-    //! 
+    //! \param[in] backend - [optional] Backend used for colour changes
+    //! \param[in] output - [optional] Standard device to write
+    //!
     //! \throw std::runtime_error - Unable to retrieve handle to stdout
     //////////////////////////////////////////////////////////////////////////////////////////
-    console_streambuf(uint32_t len = 1024) : Buffer(len), Handle(::GetStdHandle(STD_OUTPUT_HANDLE))
+    console_streambuf(uint32_t len = 1024, ConsoleBackend backend = ConsoleBackend::Automatic, ConsoleOutput output = ConsoleOutput::StdOut)
+      : Buffer(len < 2*MaxSequence ? 2*MaxSequence : len),
+        Handle(type::open(output)),
+        Backend(type::select(Handle, backend))
     {
+#ifdef _WIN32
       // Verify handle to stdout
       if (!Handle || Handle == INVALID_HANDLE_VALUE)
         throw std::runtime_error("Unable to get handle to stdout");
 
+      // Query initial attributes once, thereafter they're tracked in memory
+      ::CONSOLE_SCREEN_BUFFER_INFO sb;
+      if (Backend == ConsoleBackend::Win32 && ::GetConsoleScreenBufferInfo(Handle, &sb))
+        Attributes = sb.wAttributes;
+#endif
+      // Define put area
+      this->setp(Buffer.data(), Buffer.data() + Buffer.size());
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::console_streambuf
+    //! Construct debug-console buffer that formats VT sequences for a custom output device
+    //!
+    //! \param[in] device - Output device
+    //! \param[in] len - [optional] Initial length of buffer (in characters)
+    //!
+    //! \remarks The buffer grows rather than flushing when full, so the device only receives the contents
+    //! \remarks  upon synchronization (eg. std::flush). Each flush begins with the current attributes,
+    //! \remarks  so the device may interleave them with output from other sources.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    console_streambuf(device_t device, uint32_t len = 1024)
+      : Buffer(len < 2*MaxSequence ? 2*MaxSequence : len),
+        Handle(type::open(ConsoleOutput::StdOut)),
+        Backend(ConsoleBackend::VirtualTerminal),
+        Device(std::move(device))
+    {
       // Define put area
-      this->setp(Buffer.data(), Buffer.data() + Buffer.capacity());   
+      this->setp(Buffer.data(), Buffer.data() + Buffer.size());
+
+      // Begin with the default attributes
+      restate(DefaultAttributes);
     }
 
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
-  
+
     console_streambuf(const console_streambuf&) = default;    //!< Copying produces a deep copy  [Handle is not unique]
     console_streambuf(console_streambuf&&) = default;         //!< Can be moved
-	
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::~console_streambuf
-    //! Flushes the buffer 
+    //! Flushes the buffer
     //////////////////////////////////////////////////////////////////////////////////////////
     ~console_streambuf() override
     {
@@ -199,109 +327,164 @@ namespace wtl
     }
 
     // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::open
+    //! Retrieve the handle of a standard output device
+    //!
+    //! \param[in] output - Standard device
+    //! \return handle_t - Device handle
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static handle_t open(ConsoleOutput output)
+    {
+#ifdef _WIN32
+      return ::GetStdHandle(output == ConsoleOutput::StdErr ? STD_ERROR_HANDLE : STD_OUTPUT_HANDLE);
+#else
+      return output == ConsoleOutput::StdErr ? STDERR_FILENO : STDOUT_FILENO;
+#endif
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::select
+    //! Resolve the backend used for colour changes, enabling VT processing where requested
+    //!
+    //! \param[in] handle - Device handle
+    //! \param[in] backend - Requested backend
+    //! \return ConsoleBackend - Win32 or VirtualTerminal
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static ConsoleBackend select(handle_t handle, ConsoleBackend backend)
+    {
+#ifdef _WIN32
+      ::DWORD mode = 0;
+
+      // Attempt to enable VT processing; fallback to the console API when unavailable
+      if (backend != ConsoleBackend::Win32)
+        if (::GetConsoleMode(handle, &mode) && ::SetConsoleMode(handle, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING))
+          return ConsoleBackend::VirtualTerminal;
+
+      return backend == ConsoleBackend::VirtualTerminal ? backend : ConsoleBackend::Win32;
+#else
+      // Terminals always interpret VT sequences
+      (void)handle;
+      (void)backend;
+      return ConsoleBackend::VirtualTerminal;
+#endif
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::colour
+    //! Convert Win32 colour bits (blue=1, green=2, red=4, intensity=8) into an SGR colour parameter
+    //!
+    //! \param[in] bits - Foreground or background attributes (shifted into the low nibble)
+    //! \param[in] normal - SGR parameter of normal-intensity black (30 or 40)
+    //! \return unsigned - SGR colour parameter
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static unsigned colour(unsigned bits, unsigned normal)
+    {
+      // ANSI colour indicies are ordered red=1, green=2, blue=4
+      unsigned index = (bits & 0x4 ? 1u : 0u) | (bits & 0x2) | (bits & 0x1 ? 4u : 0u);
+
+      // Intensity selects the 'bright' colour range
+      return (bits & 0x8 ? normal + 60 : normal) + index;
+    }
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
-  private:  
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::backend const
+    //! Query the backend used for colour changes
+    //!
+    //! \return ConsoleBackend - Win32 or VirtualTerminal
+    //////////////////////////////////////////////////////////////////////////////////////////
+    ConsoleBackend backend() const
+    {
+      return Backend;
+    }
+
+  private:
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::used const
     //! Query the number of characters written to the 'put area'
-    //! 
+    //!
     //! \return uint32_t - Number of characters in the 'put area'
     //////////////////////////////////////////////////////////////////////////////////////////
     uint32_t used() const
     {
       return static_cast<uint32_t>(this->pptr() - this->pbase());
     }
-    
+
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   public:
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::push
-    //! Saves the current formatting to the stack. (Also flushes the output)
+    //! Saves the current formatting to the stack
     //////////////////////////////////////////////////////////////////////////////////////////
     void push()
     {
-      ::CONSOLE_SCREEN_BUFFER_INFO sb;
-    
-      //! Flush 'put area' to output stream
-      sync();
-
-      //! Save the current attributes
-      ::GetConsoleScreenBufferInfo(Handle, &sb);
-      Stack.push_back(sb.wAttributes);
+      Stack.push_back(Attributes);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::pop
-    //! Restores formatting previously saved to the stack. (Also flushes the output)
+    //! Restores formatting previously saved to the stack
     //////////////////////////////////////////////////////////////////////////////////////////
     void pop()
     {
       // Do nothing if empty
       if (!Stack.empty())
       {
-        //! Flush 'put area' to output stream
-        sync();
-      
+        uint16_t saved = Stack.back();
+        Stack.pop_back();
+
         //! Replace current formatting with that saved on the stack
-        ::SetConsoleTextAttribute(Handle, Stack.front()); 
-        Stack.pop_front();
+        if (saved != NoAttributes)
+          apply(saved);
       }
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::setback
     //! Modifies the background colour
-    //! 
-    //! \param[in] flag - Foreground colour
+    //!
+    //! \param[in] flag - Background colour
     //////////////////////////////////////////////////////////////////////////////////////////
     void setback(uint16_t flag)
     {
-      ::CONSOLE_SCREEN_BUFFER_INFO sb;
-    
-      //! Flush 'put area' to output stream
-      sync();
-
       // Preserve foreground formatting, change background formatting
-      ::GetConsoleScreenBufferInfo(Handle, &sb);
-      ::SetConsoleTextAttribute(Handle, (sb.wAttributes & ForegroundMask) | (flag & BackgroundMask)); 
+      uint16_t fore = Attributes != NoAttributes ? Attributes & ForegroundMask : FOREGROUND_RED|FOREGROUND_GREEN|FOREGROUND_BLUE;
+      apply(fore | (flag & BackgroundMask));
     }
-  
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::setfore
     //! Modifies the foreground/text colour
-    //! 
+    //!
     //! \param[in] flag - Foreground colour
     //////////////////////////////////////////////////////////////////////////////////////////
     void setfore(uint16_t flag)
     {
-      ::CONSOLE_SCREEN_BUFFER_INFO sb;
-    
-      //! Flush 'put area' to output stream
-      sync();
-
       // Preserve background formatting, change foreground formatting
-      ::GetConsoleScreenBufferInfo(Handle, &sb);
-      ::SetConsoleTextAttribute(Handle, (sb.wAttributes & BackgroundMask) | (flag & ForegroundMask)); 
+      uint16_t back = Attributes != NoAttributes ? Attributes & BackgroundMask : 0;
+      apply(back | (flag & ForegroundMask));
     }
 
   protected:
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::overflow
     //! Synchronizes the buffer and output sequence before writing another character
-    //! 
+    //!
     //! \param[in] ch - Character to write
     //! \return int_type - EOF if unsuccessful
     //////////////////////////////////////////////////////////////////////////////////////////
     int_type overflow(int_type ch = traits_type::eof()) override
     {
+      //! [DEVICE] Enlarge put area to avoid splitting output
+      if (Device)
+        grow();
+
       //! Commit put area to the output stream
-      if (!flush())
-      {
-        //! [FAILED] Destroy put area
-        this->setp(nullptr, nullptr);
+      else if (!flush())
         return traits_type::eof();
-      }
 
       //! [~EOF] Store character in the put area
       if (!traits_type::eq_int_type(ch, traits_type::eof()))
@@ -312,23 +495,34 @@ namespace wtl
 
       return ch;
     }
-  
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::seekpos
     //! Seeks the get-pointer and/or put-pointer to a relative position
-    //! 
+    //!
     //! \param[in] offset - Relative position
     //! \param[in] origin - Seek origin
     //! \param[in] mode - [optional] Whether to seek the get and/or put position
-    //! \return pos_type - New absolute position
+    //! \return pos_type - New absolute position, or the invalid position sentinel when using VT sequences
     //////////////////////////////////////////////////////////////////////////////////////////
 	  pos_type seekoff(off_type offset, seekdir origin, openmode mode = std::ios_base::in | std::ios_base::out) override
-	  {	
+	  {
+      // [VT] Move cursor relative to its current position, which is unknown
+      if (Backend == ConsoleBackend::VirtualTerminal)
+      {
+        if (offset.X)
+          sequence(static_cast<unsigned>(std::abs(offset.X)), offset.X < 0 ? 'D' : 'C');
+        if (offset.Y)
+          sequence(static_cast<unsigned>(std::abs(offset.Y)), offset.Y < 0 ? 'A' : 'B');
+        return pos_type(-1);
+      }
+
+#ifdef _WIN32
       ::CONSOLE_SCREEN_BUFFER_INFO sb;
 
       // Flush existing buffer
       sync();
-    
+
       // Query current position
       ::GetConsoleScreenBufferInfo(Handle, &sb);
       pos_type target = pos_type(sb.dwCursorPosition) + offset;
@@ -337,21 +531,32 @@ namespace wtl
       if (!::SetConsoleCursorPosition(Handle, target))
         // [FAILED] Return existing position
         return {sb.dwCursorPosition};
-      
+
       // Return new position
       return target;
+#else
+      return pos_type(-1);
+#endif
 	  }
 
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::seekpos
     //! Seeks the get-pointer and/or put-pointer to an absolute position
-    //! 
+    //!
     //! \param[in] pos - Absolute position
     //! \param[in] mode - [optional] Whether to seek the get and/or put position
     //! \return pos_type - New absolute position
     //////////////////////////////////////////////////////////////////////////////////////////
     pos_type seekpos(pos_type pos, openmode mode = std::ios_base::in | std::ios_base::out) override
-	  {	
+	  {
+      // [VT] Position cursor inline  (Sequence co-ordinates are one-based)
+      if (Backend == ConsoleBackend::VirtualTerminal)
+      {
+        sequence(pos.Y + 1u, ';', pos.X + 1u, 'H');
+        return pos;
+      }
+
+#ifdef _WIN32
       // Flush existing buffer
       sync();
 
@@ -367,46 +572,249 @@ namespace wtl
 
       // Return new position
       return pos;
+#else
+      return pos_type(-1);
+#endif
 	  }
 
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::sync
     //! Synchronizes the buffer and output sequence
-    //! 
+    //!
     //! \return int - 0 if successful, -1 otherwise
     //////////////////////////////////////////////////////////////////////////////////////////
     int sync() override
     {
+      // [DEVICE] Ignore put area holding only the attributes restated by the last flush
+      if (Device && Escape == this->pbase() && EscapeEnd == this->pptr())
+        return 0;
+
       return !used() || flush() ? 0 : -1;
     }
 
   private:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::apply
+    //! Changes the current text attributes, ignoring redundant changes
+    //!
+    //! \param[in] attr - Foreground and background attributes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void apply(uint16_t attr)
+    {
+      // Skip redundant changes
+      if (attr == Attributes)
+        return;
+
+      // [VT] Emit SGR sequence inline
+      if (Backend == ConsoleBackend::VirtualTerminal)
+        escape(attr);
+#ifdef _WIN32
+      // [Win32] Flush text written using the old attributes before changing them
+      else
+      {
+        sync();
+        ::SetConsoleTextAttribute(Handle, attr);
+      }
+#endif
+      Attributes = attr;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::escape
+    //! Writes an SGR sequence selecting new attributes into the put area. When the put area
+    //! ends with the previous SGR sequence (ie. no text separates them) it is overwritten.
+    //!
+    //! \param[in] attr - Foreground and background attributes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void escape(uint16_t attr)
+    {
+      // Collapse consecutive changes by discarding the trailing sequence
+      if (Escape && this->pptr() == EscapeEnd)
+      {
+        this->pbump(static_cast<int>(Escape - EscapeEnd));
+        Escape = EscapeEnd = nullptr;
+
+        // Omit sequence entirely if the terminal already has these attributes
+        if (attr == Previous)
+          return;
+      }
+      else
+        Previous = Attributes;
+
+      // Remember sequence so a subsequent change can replace it
+      if ((Escape = sequence(colour(attr & ForegroundMask, 30), ';', colour((attr & BackgroundMask) >> 4, 40), 'm')) != nullptr)
+        EscapeEnd = this->pptr();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::sequence
+    //! Writes a control sequence with one numeric parameter into the put area
+    //!
+    //! \param[in] first - First parameter
+    //! \param[in] final - Final character
+    //! \return char_type* - Start of sequence within put area, or nullptr if unsuccessful
+    //////////////////////////////////////////////////////////////////////////////////////////
+    char_type* sequence(unsigned first, char final)
+    {
+      char text[MaxSequence];
+      int len = std::snprintf(text, sizeof(text), "\x1b[%u%c", first % 100000u, final);
+      return append(text, len);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::sequence
+    //! Writes a control sequence with two numeric parameters into the put area
+    //!
+    //! \param[in] first - First parameter
+    //! \param[in] separator - Parameter separator
+    //! \param[in] second - Second parameter
+    //! \param[in] final - Final character
+    //! \return char_type* - Start of sequence within put area, or nullptr if unsuccessful
+    //////////////////////////////////////////////////////////////////////////////////////////
+    char_type* sequence(unsigned first, char separator, unsigned second, char final)
+    {
+      char text[MaxSequence];
+      int len = std::snprintf(text, sizeof(text), "\x1b[%u%c%u%c", first % 100000u, separator, second % 100000u, final);
+      return append(text, len);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::append
+    //! Copies an escape sequence into the put area, making room first if there's insufficient space
+    //!
+    //! \param[in] const* text - Escape sequence
+    //! \param[in] len - Length of sequence
+    //! \return char_type* - Start of sequence within put area, or nullptr if unsuccessful
+    //////////////////////////////////////////////////////////////////////////////////////////
+    char_type* append(const char* text, int len)
+    {
+      // [DEVICE] Enlarge put area to avoid splitting output
+      if (Device)
+        while (this->epptr() - this->pptr() < len)
+          grow();
+
+      // Ensure whole sequence fits
+      else if (this->epptr() - this->pptr() < len && !flush())
+        return nullptr;
+
+      // Widen sequence (ASCII) into the put area
+      char_type* start = this->pptr();
+      std::copy(text, text + len, start);
+      this->pbump(len);
+      return start;
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // console_streambuf::flush
-    //! Flushes the buffer to the console
-    //! 
+    //! Flushes the buffer to the console with a single write
+    //!
     //! \return bool - True iff successfully flushed buffer to output sequence
     //////////////////////////////////////////////////////////////////////////////////////////
     bool flush()
     {
-      DWORD    out = 0;
       uint32_t len = used();
 
+      // Put area is about to be recycled
+      Escape = EscapeEnd = nullptr;
+
       //! Commit put area to the output stream
-      if (!::WriteConsoleA(Handle, this->pbase(), len, &out, nullptr) || out != len)
+      if (len && !write(this->pbase(), len))
       {
         //! [FAILED] Destroy put area
         this->setp(nullptr, nullptr);
         return false;
       }
 
-      //! Update put pointer 
+      //! Update put pointer
       this->pbump(0 - len);
+
+      //! [DEVICE] Begin next output with the current attributes
+      if (Device)
+        restate(Attributes);
+      return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::grow
+    //! Doubles the length of the put area, preserving its contents
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void grow()
+    {
+      char_type* const previous = this->pbase();
+      auto offset = this->pptr() - previous;
+
+      // Reallocate then rebase the put area
+      Buffer.resize(Buffer.size() * 2);
+      this->setp(Buffer.data(), Buffer.data() + Buffer.size());
+      this->pbump(static_cast<int>(offset));
+
+      // Rebase the trailing sequence
+      if (Escape)
+      {
+        Escape = Buffer.data() + (Escape - previous);
+        EscapeEnd = Buffer.data() + (EscapeEnd - previous);
+      }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::restate
+    //! Writes an SGR sequence selecting the current attributes into the empty put area. This can be 
+    //! replaced by a subsequent change, but is always emitted because the output device's attributes are unknown.
+    //!
+    //! \param[in] attr - Foreground and background attributes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void restate(uint16_t attr)
+    {
+      Attributes = attr;
+      Previous = NoAttributes;
+      if ((Escape = sequence(colour(attr & ForegroundMask, 30), ';', colour((attr & BackgroundMask) >> 4, 40), 'm')) != nullptr)
+        EscapeEnd = this->pptr();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_streambuf::write
+    //! Writes characters to the output device
+    //!
+    //! \param[in] const* text - Characters
+    //! \param[in] len - Number of characters
+    //! \return bool - True iff all characters were written
+    //////////////////////////////////////////////////////////////////////////////////////////
+    bool write(const char_type* text, uint32_t len)
+    {
+      const char* bytes = reinterpret_cast<const char*>(text);
+      size_t      remaining = len * sizeof(char_type);
+
+      // [DEVICE] Pass to custom output
+      if (Device)
+        return Device(text, len);
+#ifdef _WIN32
+      ::DWORD out = 0;
+
+      // [Win32] Preserve legacy behaviour
+      if (Backend == ConsoleBackend::Win32)
+        return ::WriteConsoleA(Handle, bytes, len, &out, nullptr) && out == len;
+
+      // [VT] Write bytes directly, which also supports redirected output
+      return ::WriteFile(Handle, bytes, static_cast<::DWORD>(remaining), &out, nullptr) && out == remaining;
+#else
+      // Retry partial writes (eg. pipes)
+      while (remaining)
+      {
+        ssize_t out = ::write(Handle, bytes, remaining);
+        if (out < 0 && errno == EINTR)
+          continue;
+        else if (out <= 0)
+          return false;
+
+        bytes += out;
+        remaining -= static_cast<size_t>(out);
+      }
       return true;
+#endif
     }
   };
 
-  
+
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \struct console_stream - Debug-console output stream
   //! 
@@ -437,12 +845,39 @@ namespace wtl
     // console_stream::console_stream
     //! Constructs the debug console
     //! 
+    //! \param[in] len - [optional] Length of buffer (in characters)
+    //! \param[in] backend - [optional] Backend used for colour changes
+    //! \param[in] output - [optional] Standard device to write
+    //!
     //! \throw std::runtime_error - Unable to retrieve handle to stdout
     //////////////////////////////////////////////////////////////////////////////////////////
-    console_stream() : base(&Buffer)
+    console_stream(uint32_t len = 1024, ConsoleBackend backend = ConsoleBackend::Automatic, ConsoleOutput output = ConsoleOutput::StdOut) 
+      : base(&Buffer), 
+        Buffer(len, backend, output)
+    {
+      // Set user-defined formatting flag that identifies stream as a debug-console
+      this->iword(Ident) = true;
+
+      // Provide numeric formatting for the custom character traits  (Not all standard libraries create it on demand)
+      this->imbue(std::locale(this->getloc(), new std::num_put<CHAR,std::ostreambuf_iterator<CHAR,TRAITS>>()));
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // console_stream::console_stream
+    //! Constructs a debug console that formats VT sequences for a custom output device
+    //! 
+    //! \param[in] device - Output device
+    //! \param[in] len - [optional] Initial length of buffer (in characters)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    console_stream(typename console_streambuf<CHAR,TRAITS>::device_t device, uint32_t len = 1024) 
+      : base(&Buffer), 
+        Buffer(std::move(device), len)
     {
       // Set user-defined formatting flag that identifies stream as a debug-console
       this->iword(Ident) = true;
+
+      // Provide numeric formatting for the custom character traits  (Not all standard libraries create it on demand)
+      this->imbue(std::locale(this->getloc(), new std::num_put<CHAR,std::ostreambuf_iterator<CHAR,TRAITS>>()));
     }
 
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
@@ -706,6 +1141,8 @@ namespace wtl
     return os.write(str.data(), str.size());
   }
 
+//! \if _WIN32 - Enumeration and exception types are provided by the Win32 library
+#ifdef _WIN32
   //////////////////////////////////////////////////////////////////////////////////////////
   // wtl::operator <<
   //! Writes an attribute enumeration to a debug console output stream
@@ -765,6 +1202,7 @@ namespace wtl
              << '\n' << (textcol::yellow|textcol::bold) << "CAUGHT: "    << textcol::yellow << ex.source() << "..." << std::endl
              << format::pop;
   }
+#endif
 
   
   //////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,402 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\CsvReader.hpp
+//! \brief Provides a reader for delimited text (CSV, TSV) that returns fields in-place
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CSV_READER_HPP
+#define WTL_CSV_READER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/StreamView.hpp>            //!< StreamView, ViewSource
+#include <wtl/threads/WorkerThread.hpp>     //!< WorkerThread
+#include <wtl/utils/ByteSearch.hpp>         //!< WTL_SSE2, find_byte
+#include <algorithm>                        //!< std::min
+#include <string>                           //!< std::string
+#include <vector>                           //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct CsvField - Non-owning view of a single field
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct CsvField
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    StreamView<char>  Text;       //!< Field text, excluding enclosing quotes
+    bool              Escaped;    //!< Whether text contains doubled (escaped) quotes
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvField::str const
+    //! Copy the field text, collapsing escaped quotes
+    //!
+    //! \param[in] quote - [optional] Quote character  (Default is '"')
+    //! \return std::string - Field value
+    //!
+    //! \throw wtl::logic_error - [Debug only] Field has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::string str(char quote = '"') const
+    {
+      if (!Escaped)
+        return Text.str();
+
+      // Copy text, skipping the first of each pair of quotes
+      std::string s;
+      s.reserve(Text.size());
+      for (const char* pos = Text.begin(), *end = Text.end(); pos != end; ++pos)
+      {
+        s += *pos;
+        if (*pos == quote && pos + 1 != end)
+          ++pos;
+      }
+      return s;
+    }
+  };
+
+  //! \alias CsvRow - Fields of a single row. Reuse between rows to avoid reallocation.
+  using CsvRow = std::vector<CsvField>;
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct CsvReader - Reads rows of delimited text from an input stream without copying them
+  //!
+  //! \tparam STREAM - Input stream type
+  //!
+  //! \remarks Quotes, delimiters and line-feeds are classified sixteen characters at a time; quoted regions are
+  //! \remarks identified by a prefix-xor of the quote positions so their contents are never examined individually.
+  //! \remarks Fields may be quoted, and quoted fields may contain delimiters, line-breaks and doubled quotes. Rows
+  //! \remarks are terminated by LF or CRLF; the final row need not be terminated.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct CsvReader
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = CsvReader<STREAM>;
+
+    //! \typedef element_t - Stream element type
+    typedef typename STREAM::element_t element_t;
+
+    //! \typedef stream_t - Stream type
+    typedef STREAM stream_t;
+
+    static_assert(std::is_same<element_t,char>::value, "Delimited text requires a narrow character stream");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    STREAM      Stream;         //!< Input stream
+
+  protected:
+    ViewSource  Views;          //!< Lifetime of views upon the stream buffer
+    char        Delimiter;      //!< Field delimiter
+    char        Quote;          //!< Quote character
+    std::string Spanned;        //!< Row that spanned a refill of the stream buffer
+    uint32_t    Unreleased;     //!< Length of row viewed in-place whose release is deferred
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::CsvReader
+    //! Create a delimited text reader and initialise the input stream
+    //!
+    //! \tparam ARGS... - Arguments parameter pack type
+    //!
+    //! \param[in] delimiter - Field delimiter  (eg. ',' or '\t')
+    //! \param[in,out] &&... args - Stream constructor arguments
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    CsvReader(char delimiter, ARGS&&... args) : Stream(std::forward<ARGS>(args)...),
+                                                Delimiter(delimiter),
+                                                Quote('"'),
+                                                Unreleased(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    ENABLE_COPY(CsvReader);        //!< Copy semantics determined by stream type
+    ENABLE_MOVE(CsvReader);        //!< Move semantics determined by stream type
+    ENABLE_POLY(CsvReader);        //!< Can be polymorphic
+
+	  // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::classify
+    //! Identifies the unquoted delimiters and line-feeds within a block of up to sixteen characters
+    //!
+    //! \param[in] const* pos - First character
+    //! \param[in] count - Number of characters (at most 16)
+    //! \param[in] delimiter - Field delimiter
+    //! \param[in] quote - Quote character
+    //! \param[in,out] &inside - On input, all-ones if the block begins within quotes, otherwise zero. On output,
+    //!                          the same for the following block.
+    //! \return uint32_t - Bitmask of delimiters and line-feeds that are not quoted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t classify(const char* pos, uint32_t count, char delimiter, char quote, uint32_t& inside) noexcept
+    {
+      uint32_t quotes = 0,
+               separators = 0;
+
+#if WTL_SSE2
+      // Compare sixteen characters at once
+      if (count == 16)
+      {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+        quotes = _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(quote)));
+        separators = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(delimiter)),
+                                                    _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))));
+      }
+      else
+#endif
+      for (uint32_t idx = 0; idx < count; ++idx)
+      {
+        quotes |= (pos[idx] == quote ? 1u : 0u) << idx;
+        separators |= (pos[idx] == delimiter || pos[idx] == '\n' ? 1u : 0u) << idx;
+      }
+
+      // Prefix-xor: bit 'n' is set iff an odd number of quotes lie at or before position 'n'. Doubled quotes cancel out.
+      uint32_t quoted = quotes;
+      quoted ^= quoted << 1;
+      quoted ^= quoted << 2;
+      quoted ^= quoted << 4;
+      quoted ^= quoted << 8;
+      quoted = (quoted ^ inside) & 0xFFFF;
+
+      // Carry quote state into the next block
+      inside = (quoted >> 15) & 1 ? 0xFFFF : 0;
+      return separators & ~quoted & ((1u << count) - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::appendField
+    //! Appends a field to a row, removing enclosing quotes
+    //!
+    //! \param[in,out] &row - Row
+    //! \param[in] const* first - First character of field
+    //! \param[in] const* last - Position beyond last character of field
+    //! \param[in] quote - Quote character
+    //! \param[in] const& src - Lifetime token of the stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void appendField(CsvRow& row, const char* first, const char* last, char quote, const ViewSource& src)
+    {
+      bool escaped = false;
+
+      // [QUOTED] Exclude enclosing quotes; a quote remaining within the text is necessarily escaped
+      if (last - first >= 2 && *first == quote && last[-1] == quote)
+      {
+        ++first, --last;
+        escaped = find_byte(first, last, quote) != last;
+      }
+
+      row.push_back({ StreamView<char>(first, static_cast<uint32_t>(last - first), src), escaped });
+    }
+
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::scanRow
+    //! Splits the row at the start of a buffer into fields
+    //!
+    //! \param[in] const* pos - First character of row
+    //! \param[in] const* end - Position beyond last character of buffer
+    //! \param[in] delimiter - Field delimiter
+    //! \param[in] quote - Quote character
+    //! \param[in] const& src - Lifetime token of the buffer
+    //! \param[in,out] &row - On output, fields of the row. Existing fields are discarded.
+    //! \return const char* - Position beyond the row terminator, or nullptr if the buffer ends first. The fields of the
+    //!                        unterminated row extend to 'end'.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scanRow(const char* pos, const char* end, char delimiter, char quote, const ViewSource& src, CsvRow& row)
+    {
+      const char* field = pos;
+      uint32_t inside = 0;
+
+      row.clear();
+
+      // Examine blocks of sixteen characters
+      for (const char* block = pos; block < end; block += 16)
+      {
+        uint32_t count = static_cast<uint32_t>(std::min<ptrdiff_t>(end - block, 16));
+
+        // Split at each unquoted separator
+        for (uint32_t mask = classify(block, count, delimiter, quote, inside); mask != 0; mask &= mask - 1)
+        {
+          const char* separator = block + lowest_bit(mask);
+
+          // [DELIMITER] Begin next field
+          if (*separator != '\n')
+          {
+            appendField(row, field, separator, quote, src);
+            field = separator + 1;
+            continue;
+          }
+
+          // [LINE-FEED] Complete row, excluding carriage return of CRLF
+          appendField(row, field, separator != field && separator[-1] == '\r' ? separator - 1 : separator, quote, src);
+          return separator + 1;
+        }
+      }
+
+      // [UNTERMINATED] Row is incomplete, or the final row
+      appendField(row, field, end, quote, src);
+      return nullptr;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::readRow
+    //! Reads the next row, without copying it unless it spans a refill of the stream buffer, and advances the 
+    //! stream beyond its terminator
+    //!
+    //! \param[in,out] &row - On output, views of each field. Existing fields are discarded.
+    //! \return bool - True if a row was read, false if the stream is exhausted
+    //!
+    //! \remarks Rows within the stream buffer are viewed in-place, and released upon the next read. Rows that span
+    //! \remarks  a refill are gathered into an internal buffer. Either way the fields remain valid until the next read.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool readRow(CsvRow& row)
+    {
+      settle();
+
+      // [EXHAUSTED] Nothing to read
+      if (Stream.remaining() <= 0)
+        return false;
+
+      // [FOUND] Split buffer in-place, deferring its release until the next read in case releasing refills the buffer
+      const element_t *pos = Stream.buffer(),
+                      *end = pos + Stream.remaining();
+      if (const element_t* next = scanRow(pos, end, Delimiter, Quote, Views, row))
+      {
+        Unreleased = static_cast<uint32_t>(next - pos);
+        return true;
+      }
+
+      // [SPANNED] Gather the row until its terminator or the end of the stream, since releasing may refill the buffer
+      Views.invalidate();
+      Spanned.assign(pos, end);
+      Stream.release(static_cast<uint32_t>(end - pos));
+
+      while (Stream.remaining() > 0)
+      {
+        const uint32_t chunk = static_cast<uint32_t>(Stream.remaining());
+        Spanned.append(Stream.buffer(), chunk);
+
+        // [TERMINATED] Release only the input that completes the row
+        if (const element_t* next = scanRow(Spanned.data(), Spanned.data() + Spanned.size(), Delimiter, Quote, Views, row))
+        {
+          Stream.release(chunk - static_cast<uint32_t>(Spanned.data() + Spanned.size() - next));
+          return true;
+        }
+        Stream.release(chunk);
+      }
+
+      // [UNTERMINATED] Final row
+      scanRow(Spanned.data(), Spanned.data() + Spanned.size(), Delimiter, Quote, Views, row);
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::readRows
+    //! Reads all remaining rows, splitting the buffer into chunks that are processed concurrently
+    //!
+    //! \tparam FUNC - Callable type with signature void (uint32_t, const CsvRow&)
+    //!
+    //! \param[in] const& fn - Invoked for each row with the zero-based chunk index. Invoked concurrently for different
+    //!                        chunks; rows within each chunk are delivered in order.
+    //! \param[in] threads - Maximum number of threads
+    //! \return uint32_t - Number of chunks
+    //!
+    //! \remarks Chunk boundaries are chosen by counting quotes within each chunk concurrently, deriving the quote
+    //! \remarks state at each boundary, then advancing each boundary to the start of the next row.
+    //! \remarks
+    //! \remarks Only the input currently buffered is split concurrently, so the stream must hold the whole input in
+    //! \remarks  one buffer (eg. a memory-mapped file). Refilling streams are read sequentially, one row at a time.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    uint32_t readRows(const FUNC& fn, uint32_t threads)
+    {
+      settle();
+      const element_t *first = Stream.buffer(),
+                      *last = first + Stream.remaining();
+
+      // [SMALL] Process sequentially
+      const ptrdiff_t length = last - first,
+                      minimumChunk = 64 * 1024;
+      threads = static_cast<uint32_t>(std::max<ptrdiff_t>(1, std::min<ptrdiff_t>(threads, length / minimumChunk)));
+      if (threads == 1)
+      {
+        CsvRow row;
+        while (readRow(row))
+          fn(0, row);
+        return 1;
+      }
+
+      // Count quotes within each nominal chunk concurrently
+      std::vector<const element_t*> bounds(threads + 1);
+      std::vector<uint32_t> quotes(threads);
+      std::vector<WorkerThread> workers;
+      for (uint32_t idx = 0; idx <= threads; ++idx)
+        bounds[idx] = first + length * idx / threads;
+
+      for (uint32_t idx = 0; idx < threads; ++idx)
+        workers.emplace_back([&, idx] { quotes[idx] = static_cast<uint32_t>(std::count(bounds[idx], bounds[idx+1], Quote)); });
+      for (auto& w : workers)
+        w.join();
+      workers.clear();
+
+      // Advance each boundary to the start of the next row, given the quote parity preceding it
+      uint32_t parity = 0;
+      for (uint32_t idx = 1; idx < threads; ++idx)
+      {
+        parity ^= quotes[idx-1] & 1;
+
+        const element_t* pos = bounds[idx];
+        for (bool inside = parity != 0; pos != last && (inside || *pos != '\n'); ++pos)
+          inside ^= (*pos == Quote);
+
+        bounds[idx] = std::max(bounds[idx-1], pos != last ? pos + 1 : last);
+      }
+
+      // Split each chunk into rows concurrently
+      for (uint32_t idx = 0; idx < threads; ++idx)
+        workers.emplace_back([&, idx]
+        {
+          CsvRow row;
+          for (const element_t* pos = bounds[idx], *next; pos < bounds[idx+1]; pos = next ? next : bounds[idx+1])
+          {
+            next = scanRow(pos, bounds[idx+1], Delimiter, Quote, Views, row);
+            fn(idx, row);
+          }
+        });
+      for (auto& w : workers)
+        w.join();
+
+      // Release stream, advancing beyond all rows
+      Stream.release(static_cast<uint32_t>(length));
+      return threads;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CsvReader::settle
+    //! Releases the row viewed in-place by the last call to 'readRow', before the stream is read again
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void settle()
+    {
+      if (Unreleased)
+      {
+        Stream.release(Unreleased);
+        Unreleased = 0;
+      }
+    }
+  };
+
+} //namespace wtl
+#endif // WTL_CSV_READER_HPP
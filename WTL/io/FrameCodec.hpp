@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\FrameCodec.hpp
+//! \brief Provides length-prefixed message framing for stream protocols
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FRAME_CODEC_HPP
+#define WTL_FRAME_CODEC_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/VarInt.hpp>            //!< varint_encode, varint_decode
+#include <wtl/io/BinaryWriter.hpp>      //!< BinaryWriter
+#include <algorithm>                    //!< std::min
+#include <vector>                       //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \var FrameMaxLength - Default maximum length of a frame payload
+  constexpr uint32_t FrameMaxLength = 16 * 1024 * 1024;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::write_frame
+  //! Writes a frame, consisting of the payload length as a varint followed by the payload
+  //!
+  //! \tparam STREAM - Output stream type
+  //!
+  //! \param[in,out] &w - Writer
+  //! \param[in] const* payload - Payload
+  //! \param[in] length - Length of payload, in bytes
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  void write_frame(BinaryWriter<STREAM>& w, const byte* payload, uint32_t length)
+  {
+    w.writeVarInt(length);
+    w.write(payload, length);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::append_frame
+  //! Appends a frame to a buffer
+  //!
+  //! \param[in,out] &output - Buffer
+  //! \param[in] const* payload - Payload
+  //! \param[in] length - Length of payload, in bytes
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline void append_frame(std::vector<byte>& output, const byte* payload, uint32_t length)
+  {
+    byte header[VarIntMaxLength];
+    uint32_t size = varint_encode(length, header);
+
+    output.insert(output.end(), header, header + size);
+    output.insert(output.end(), payload, payload + length);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FrameDecoder - Reassembles frames from arbitrarily fragmented input
+  //!
+  //! \remarks Frames lying wholly within the input are delivered in place, without copying. Only a frame spanning
+  //! \remarks  the end of the input is copied, and it's delivered from the decoder once the remainder arrives.
+  //! \remarks  Delivered payloads are only valid until the delivery callback returns.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct FrameDecoder
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<byte>  Partial;       //!< Frame spanning the end of the previous input
+    uint32_t           MaxLength;     //!< Maximum payload length
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameDecoder::FrameDecoder
+    //! Create decoder
+    //!
+    //! \param[in] maxLength - [optional] Maximum payload length, protecting against corrupt or hostile input
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    FrameDecoder(uint32_t maxLength = FrameMaxLength) : MaxLength(maxLength)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(FrameDecoder);      //!< Can be copied
+    ENABLE_MOVE(FrameDecoder);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameDecoder::buffered const
+    //! Get the number of bytes of an incomplete frame held by the decoder
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t buffered() const
+    {
+      return static_cast<uint32_t>(Partial.size());
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameDecoder::feed
+    //! Decodes input, delivering each frame it completes
+    //!
+    //! \tparam CALLBACK - Callable with signature void(const byte* payload, uint32_t length)
+    //!
+    //! \param[in] const* data - Input
+    //! \param[in] length - Length of input, in bytes
+    //! \param[in,out] &&callback - Frame consumer
+    //! \return uint32_t - Number of frames delivered
+    //!
+    //! \throw wtl::domain_error - Malformed length or payload exceeds maximum
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CALLBACK>
+    uint32_t feed(const byte* data, uint32_t length, CALLBACK&& callback)
+    {
+      const byte *pos = data,
+                 *end = data + length;
+      uint32_t frames = 0;
+
+      // [PARTIAL] Complete the frame spanning the previous input
+      while (!Partial.empty())
+      {
+        uint64_t payload;
+        uint32_t header = varint_decode(Partial.data(), Partial.data() + Partial.size(), payload);
+
+        // [HEADER] Complete length one byte at a time
+        if (!header)
+        {
+          if (Partial.size() >= VarIntMaxLength)
+            throw wtl::domain_error(HERE, "Malformed frame length");
+          if (pos == end)
+            return frames;
+
+          Partial.push_back(*pos++);
+          continue;
+        }
+        verify(payload);
+
+        // [PAYLOAD] Copy as much of the remainder as is available
+        const size_t total = header + static_cast<size_t>(payload),
+                     take = std::min<size_t>(total - Partial.size(), end - pos);
+        Partial.insert(Partial.end(), pos, pos + take);
+        pos += take;
+        if (Partial.size() < total)
+          return frames;
+
+        callback(Partial.data() + header, static_cast<uint32_t>(payload));
+        Partial.clear();
+        ++frames;
+      }
+
+      // [IN-PLACE] Deliver whole frames directly from the input
+      while (pos != end)
+      {
+        uint64_t payload;
+        uint32_t header = varint_decode(pos, end, payload);
+
+        if (!header)
+        {
+          if (end - pos >= static_cast<ptrdiff_t>(VarIntMaxLength))
+            throw wtl::domain_error(HERE, "Malformed frame length");
+          break;
+        }
+        verify(payload);
+
+        if (payload > static_cast<uint64_t>(end - pos - header))
+          break;
+
+        callback(pos + header, static_cast<uint32_t>(payload));
+        pos += header + payload;
+        ++frames;
+      }
+
+      // Retain incomplete frame
+      Partial.assign(pos, end);
+      return frames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameDecoder::reset
+    //! Discards any incomplete frame
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void reset()
+    {
+      Partial.clear();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameDecoder::verify const
+    //! Verifies a payload length
+    //!
+    //! \param[in] payload - Payload length
+    //!
+    //! \throw wtl::domain_error - Payload exceeds maximum
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void verify(uint64_t payload) const
+    {
+      if (payload > MaxLength)
+        throw wtl::domain_error(HERE, "Frame of ", payload, " bytes exceeds maximum of ", MaxLength);
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_FRAME_CODEC_HPP
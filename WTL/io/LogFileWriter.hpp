@@ -10,6 +10,8 @@
 #define WTL_LOG_FILE_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/io/AsyncLogQueue.hpp>     //!< AsyncLogQueue
+#include <cstring>                      //!< strlen
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -157,6 +159,118 @@ namespace wtl
   protected:
   };
   
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct AsyncLogFileWriter - Writes debug console output to disc as Rtf without blocking the caller
+  //! 
+  //! \tparam STREAM - Stream type
+  //!
+  //! \remarks Callers append records to a lock-free front buffer. A dedicated thread swaps the buffers, formats the
+  //! \remarks back buffer as Rtf and writes it to disc, so neither formatting nor I/O occurs on the calling thread.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct AsyncLogFileWriter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  
+    //! \typedef writer_t - Defines synchronous writer type
+    typedef LogFileWriter<STREAM> writer_t;
+
+    //! \typedef stream_t - Log stream type
+    typedef STREAM stream_t;
+    
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    writer_t       Writer;      //!< Synchronous writer, accessed only by the flush thread
+    AsyncLogQueue  Queue;       //!< Record queue and flush thread
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::AsyncLogFileWriter 
+    //! Create an asynchronous log file writer, initialise the output stream and start the flush thread
+    //! 
+    //! \tparam ARGS... - Arguments parameter pack type
+    //! 
+    //! \param[in] capacity - Capacity of each buffer, in bytes
+    //! \param[in] policy - Behaviour of writers when the front buffer is full
+    //! \param[in,out] &&... args - Stream constructor arguments
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    AsyncLogFileWriter(uint32_t capacity, OverflowPolicy policy, ARGS&&... args) 
+      : Writer(std::forward<ARGS>(args)...),
+        Queue([this] (uint32_t attr, const char* txt, uint32_t len) { Writer.write(txt, static_cast<Cons>(attr)); },
+              [this] () { Writer.flush(); },
+              capacity, 
+              policy)
+    {}
+      
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    DISABLE_COPY(AsyncLogFileWriter);       //!< Cannot be copied
+    DISABLE_MOVE(AsyncLogFileWriter);       //!< Cannot be moved; the flush thread refers to it
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::~AsyncLogFileWriter 
+    //! Writes remaining records and stops the flush thread before the stream is closed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~AsyncLogFileWriter()
+    {
+      Queue.close();
+    }
+	
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::statistics const
+    //! Get latency and throughput statistics
+    //! 
+    //! \return LogStatistics - Snapshot of statistics
+    /////////////////////////////////////////////////////////////////////////////////////////
+    LogStatistics statistics() const
+    {
+      return Queue.statistics();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::close
+    //! Writes remaining records, stops the flush thread and closes the output stream
+    //! 
+    //! \throw wtl::domain_error - I/O error occurred
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      Queue.close();
+      Writer.close();
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::flush
+    //! Barrier that waits until all records written before the call have been flushed to disc
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      Queue.flush();
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // AsyncLogFileWriter::write 
+    //! Queue text for the log file
+    //! 
+    //! \param[in] const* txt - Output string
+    //! \param[in] attributes - Attributes
+    //! \return bool - True if queued, false if dropped because the buffer is full
+    //! 
+    //! \throw wtl::length_error - Text exceeds buffer capacity
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool write(const char* txt, Cons attributes)
+    {
+      // Queue text including its terminator, so the flush thread can format it in-place
+      return Queue.write(static_cast<uint32_t>(attributes), txt, static_cast<uint32_t>(strlen(txt)) + 1);
+    }
+  };
+  
   //! \typedef log_writer_t - Log-file writer type
   typedef LogFileWriter<LocalFileStream<char>> logfile_writer_t;
 
@@ -0,0 +1,1068 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\LzStream.hpp
+//! \brief Provides a fast LZ block compressor and stream adapters that compress or decompress inline
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_LZ_STREAM_HPP
+#define WTL_LZ_STREAM_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/threads/WorkerThread.hpp>     //!< WorkerThread
+#include <wtl/utils/ByteSearch.hpp>         //!< lowest_bit
+#include <algorithm>                        //!< std::min
+#include <cstring>                          //!< std::memcpy
+#include <vector>                           //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \var LzMinMatch - Length of the shortest match
+  constexpr uint32_t LzMinMatch = 4;
+
+  //! \var LzLastLiterals - Number of bytes at the end of a block that are always encoded as literals
+  constexpr uint32_t LzLastLiterals = 5;
+
+  //! \var LzMatchLimit - Minimum distance between the start of the last match and the end of a block
+  constexpr uint32_t LzMatchLimit = 12;
+
+  //! \var LzMaxOffset - Greatest distance between a match and the bytes it repeats
+  constexpr uint32_t LzMaxOffset = 65535;
+
+  //! \var LzHashLog - Number of bits in the hash of a 4-byte sequence
+  constexpr uint32_t LzHashLog = 12;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_read32
+  //! Reads an unaligned 32-bit word
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lz_read32(const byte* pos) noexcept
+  {
+    uint32_t value;
+    std::memcpy(&value, pos, sizeof(value));
+    return value;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_read64
+  //! Reads an unaligned 64-bit word
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint64_t lz_read64(const byte* pos) noexcept
+  {
+    uint64_t value;
+    std::memcpy(&value, pos, sizeof(value));
+    return value;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_hash
+  //! Hashes a 4-byte sequence (Fibonacci hashing)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lz_hash(uint32_t sequence) noexcept
+  {
+    return (sequence * 2654435761u) >> (32 - LzHashLog);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_copy_words
+  //! Copies bytes a word at a time, overrunning by up to 7 bytes. Source and destination may overlap
+  //! provided the source precedes the destination by at least one word.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline void lz_copy_words(byte* dst, const byte* src, uint32_t length) noexcept
+  {
+    for (byte* const end = dst + length; dst < end; dst += sizeof(uint64_t), src += sizeof(uint64_t))
+    {
+      uint64_t word = lz_read64(src);
+      std::memcpy(dst, &word, sizeof(word));
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_compress_bound
+  //! Query the worst-case size of a compressed block
+  //!
+  //! \param[in] length - Length of input, in bytes
+  //! \return uint32_t - Capacity guaranteeing lz_compress() succeeds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t lz_compress_bound(uint32_t length) noexcept
+  {
+    return length + length / 255 + 16;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_write_length
+  //! Writes the remainder of a literal or match length as a run of 255s plus a final byte
+  //!
+  //! \param[in,out] *out - Output position
+  //! \param[in] extra - Length exceeding the 4-bit token field
+  //! \return byte* - Position following the length
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline byte* lz_write_length(byte* out, uint32_t extra) noexcept
+  {
+    for (; extra >= 255; extra -= 255)
+      *out++ = 255;
+    *out++ = static_cast<byte>(extra);
+    return out;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_read_length
+  //! Reads the remainder of a literal or match length
+  //!
+  //! \param[in,out] &in - Input position, advanced beyond the length
+  //! \param[in] const* end - End of input
+  //! \return uint32_t - Length exceeding the 4-bit token field
+  //!
+  //! \throw wtl::domain_error - Length is truncated or implausibly large
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lz_read_length(const byte*& in, const byte* end)
+  {
+    uint32_t length = 0;
+    for (byte b = 255; b == 255; length += b)
+    {
+      if (in == end || length > (1u << 30))
+        throw wtl::domain_error(HERE, "Malformed compressed block length");
+      b = *in++;
+    }
+    return length;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_compress
+  //! Compresses a block of bytes independently of any other block
+  //!
+  //! \param[in] const* src - Input
+  //! \param[in] length - Length of input, in bytes
+  //! \param[in,out] *dst - Output
+  //! \param[in] capacity - Capacity of output, in bytes
+  //! \return uint32_t - Length of compressed block, or zero if it would exceed 'capacity'
+  //!
+  //! \remarks The output is a sequence of tokens holding the lengths of a run of literals and the match that
+  //! \remarks  follows them, as used by LZ4. Matches are found through a single-entry hash table of 4-byte
+  //! \remarks  sequences, and the search skips ahead faster the longer it goes without finding one.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lz_compress(const byte* src, uint32_t length, byte* dst, uint32_t capacity) noexcept
+  {
+    const byte* const end = src + length;
+    const byte*       anchor = src;         // Start of pending literals
+    byte*             out = dst;
+    byte* const       outEnd = dst + capacity;
+
+    if (length > LzMatchLimit)
+    {
+      uint32_t table[1u << LzHashLog] = {};
+      const byte* const matchLimit = end - LzMatchLimit,      // Matches must start before here
+                  * const matchEnd = end - LzLastLiterals;    // Matches must end before here
+
+      for (const byte* pos = src + 1; pos < matchLimit; )
+      {
+        const byte* match;
+
+        // Search for a match, accelerating through incompressible input
+        for (uint32_t attempts = 1u << 6; ; pos += attempts++ >> 6)
+        {
+          if (pos >= matchLimit)
+            goto last_literals;
+
+          uint32_t& slot = table[lz_hash(lz_read32(pos))];
+          match = src + slot;
+          slot = static_cast<uint32_t>(pos - src);
+
+          if (match < pos && pos - match <= LzMaxOffset && lz_read32(match) == lz_read32(pos))
+            break;
+        }
+
+        // Extend backwards into the pending literals
+        while (pos > anchor && match > src && pos[-1] == match[-1])
+          --pos, --match;
+
+        // Extend forwards a word at a time
+        const byte* next = pos + LzMinMatch;
+        for (const byte* ref = match + LzMinMatch; next < matchEnd; )
+        {
+          if (next + sizeof(uint64_t) <= matchEnd)
+          {
+            if (uint64_t diff = lz_read64(next) ^ lz_read64(ref))
+            {
+              next += lowest_bit(diff) / 8;
+              break;
+            }
+            next += sizeof(uint64_t), ref += sizeof(uint64_t);
+          }
+          else if (*next == *ref)
+            ++next, ++ref;
+          else
+            break;
+        }
+
+        // Ensure sequence fits
+        uint32_t literals = static_cast<uint32_t>(pos - anchor),
+                 extra = static_cast<uint32_t>(next - pos) - LzMinMatch;
+        if (outEnd - out < static_cast<ptrdiff_t>(1 + literals/255 + 1 + literals + 2 + extra/255 + 1))
+          return 0;
+
+        // Write token, literals, offset, then remainder of match length
+        byte* token = out++;
+        *token = static_cast<byte>(std::min(literals, 15u) << 4 | std::min(extra, 15u));
+        if (literals >= 15)
+          out = lz_write_length(out, literals - 15);
+        std::memcpy(out, anchor, literals);
+        out += literals;
+
+        uint32_t offset = static_cast<uint32_t>(pos - match);
+        *out++ = static_cast<byte>(offset);
+        *out++ = static_cast<byte>(offset >> 8);
+        if (extra >= 15)
+          out = lz_write_length(out, extra - 15);
+
+        // Resume after match, remembering a position within it to improve subsequent matches
+        pos = anchor = next;
+        if (pos < matchLimit)
+          table[lz_hash(lz_read32(pos - 2))] = static_cast<uint32_t>(pos - 2 - src);
+      }
+    }
+
+  last_literals:
+    // Final sequence holds only literals
+    uint32_t literals = static_cast<uint32_t>(end - anchor);
+    if (outEnd - out < static_cast<ptrdiff_t>(1 + literals/255 + 1 + literals))
+      return 0;
+
+    *out++ = static_cast<byte>(std::min(literals, 15u) << 4);
+    if (literals >= 15)
+      out = lz_write_length(out, literals - 15);
+    if (literals)
+      std::memcpy(out, anchor, literals);
+    out += literals;
+
+    return static_cast<uint32_t>(out - dst);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lz_decompress
+  //! Decompresses a block produced by lz_compress()
+  //!
+  //! \param[in] const* src - Compressed block
+  //! \param[in] length - Length of compressed block, in bytes
+  //! \param[in,out] *dst - Output
+  //! \param[in] capacity - Capacity of output, in bytes
+  //! \return uint32_t - Length of decompressed block
+  //!
+  //! \throw wtl::domain_error - Block is malformed or decompresses beyond 'capacity'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lz_decompress(const byte* src, uint32_t length, byte* dst, uint32_t capacity)
+  {
+    const byte*       in = src;
+    const byte* const inEnd = src + length;
+    byte*             out = dst;
+    byte* const       outEnd = dst + capacity;
+
+    while (in < inEnd)
+    {
+      const uint32_t token = *in++;
+
+      // Copy literals
+      uint32_t literals = token >> 4;
+      if (literals == 15)
+        literals += lz_read_length(in, inEnd);
+      if (literals > static_cast<size_t>(inEnd - in) || literals > static_cast<size_t>(outEnd - out))
+        throw wtl::domain_error(HERE, "Malformed compressed block literals");
+
+      // Copy whole words where there's slack for the overrun
+      if (literals + 8 <= static_cast<size_t>(inEnd - in) && literals + 8 <= static_cast<size_t>(outEnd - out))
+        lz_copy_words(out, in, literals);
+      else
+        std::memcpy(out, in, literals);
+      in += literals;
+      out += literals;
+
+      // [LAST] Final sequence has no match
+      if (in == inEnd)
+        break;
+
+      // Read offset then match length
+      if (inEnd - in < 2)
+        throw wtl::domain_error(HERE, "Truncated compressed block");
+      const uint32_t offset = in[0] | in[1] << 8;
+      in += 2;
+
+      uint32_t match = token & 0x0f;
+      if (match == 15)
+        match += lz_read_length(in, inEnd);
+      match += LzMinMatch;
+
+      if (!offset || offset > static_cast<size_t>(out - dst) || match > static_cast<size_t>(outEnd - out))
+        throw wtl::domain_error(HERE, "Malformed compressed block match");
+
+      // Copy match, which overlaps its output when longer than the offset
+      const byte* ref = out - offset;
+      if (offset >= 8 && match + 8 <= static_cast<size_t>(outEnd - out))
+        lz_copy_words(out, ref, match);
+      else if (offset >= match)
+        std::memcpy(out, ref, match);
+      else
+        for (uint32_t idx = 0; idx < match; ++idx)
+          out[idx] = ref[idx];
+      out += match;
+    }
+
+    return static_cast<uint32_t>(out - dst);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LzBlockHeader - Precedes each block of a compressed stream
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LzBlockHeader
+  {
+    //! \var Stored - Bit of the stored length indicating the block is stored without compression
+    static constexpr uint32_t Stored = 0x80000000;
+
+    uint32_t  Size;         //!< Length of block data, in bytes, combined with the 'Stored' bit  (Zero marks the end of the blocks)
+    uint32_t  Length;       //!< Length of block once decompressed, in bytes
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LzIndexEntry - Locates a block within a compressed stream
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LzIndexEntry
+  {
+    uint64_t  Offset;       //!< Position of block header within the compressed stream
+    uint64_t  Position;     //!< Position of block data within the decompressed stream
+  };
+
+  //! \var LzStreamMagic - Identifies the start of a compressed stream
+  constexpr uint32_t LzStreamMagic = 0x315A4C57;      // "WLZ1"
+
+  //! \var LzIndexMagic - Identifies the end of a compressed stream, following its index
+  constexpr uint32_t LzIndexMagic = 0x585A4C57;       // "WLZX"
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LzOutputStream - Output stream adapter that compresses its output in independent blocks
+  //!
+  //! \tparam STREAM - Output stream type with single-byte elements
+  //!
+  //! \remarks Output is buffered until one block per thread has been written, then the blocks are compressed
+  //! \remarks  concurrently and written in order. Blocks incompressible input are stored verbatim. Closing the stream
+  //! \remarks  writes an index of every block, allowing random access through LzArchive.
+  //!
+  //! \remarks The buffer always has at least one block of free space, so writers may write directly into buffer().
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct LzOutputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = LzOutputStream<STREAM>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef typename STREAM::distance_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef typename STREAM::element_t element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef typename STREAM::position_t position_t;
+
+    //! \typedef stream_t - Stream type
+    typedef STREAM stream_t;
+
+    static_assert(sizeof(element_t) == 1, "Compressed streams require single-byte elements");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    stream_t                   Stream;       //!< Output stream
+    uint32_t                   BlockSize;    //!< Length of each uncompressed block, in bytes
+    uint32_t                   Threads;      //!< Number of blocks compressed concurrently
+    std::vector<byte>          Input;        //!< Uncompressed output
+    uint32_t                   Used;         //!< Number of bytes in 'Input'
+    std::vector<byte>          Output;       //!< Compressed blocks (One per thread)
+    std::vector<LzIndexEntry>  Index;        //!< Location of each block
+    LzIndexEntry               Next;         //!< Location of next block
+    bool                       Closed;       //!< Whether stream has been closed
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::LzOutputStream
+    //! Create the adapter and write the stream header
+    //!
+    //! \tparam ARGS... - Stream constructor argument types
+    //!
+    //! \param[in] blockSize - Length of each uncompressed block, in bytes  (Between 1KB and 1GB)
+    //! \param[in] threads - Number of blocks to compress concurrently
+    //! \param[in,out] &&... args - Stream constructor arguments
+    //!
+    //! \throw wtl::invalid_argument - Invalid block size or number of threads
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    LzOutputStream(uint32_t blockSize, uint32_t threads, ARGS&&... args)
+      : Stream(std::forward<ARGS>(args)...),
+        BlockSize(blockSize),
+        Threads(threads),
+        Used(0),
+        Next{0, 0},
+        Closed(false)
+    {
+      if (blockSize < 1024 || blockSize > (1u << 30))
+        throw wtl::invalid_argument(HERE, "Block size must be between 1KB and 1GB");
+      if (threads < 1 || threads > 256)
+        throw wtl::invalid_argument(HERE, "Number of threads must be between 1 and 256");
+
+      Input.resize(static_cast<size_t>(threads + 1) * blockSize);
+      Output.resize(static_cast<size_t>(threads) * lz_compress_bound(blockSize));
+
+      const uint32_t header[] = { LzStreamMagic, blockSize };
+      emit(header, sizeof(header));
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(LzOutputStream);     //!< Cannot be copied
+    ENABLE_MOVE(LzOutputStream);      //!< Can be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::~LzOutputStream
+    //! Closes the stream if necessary, ignoring any errors
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~LzOutputStream()
+    {
+      try
+      {
+        if (!Closed && !Input.empty())
+          close();
+      }
+      catch (...)
+      {}
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::remaining() const
+    //! Get the number of bytes that can be written before the buffered blocks are compressed
+    //!
+    //! \return distance_t - Free space within buffer  (Always at least one block)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(Input.size() - Used);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::index() const
+    //! Get the location of each block written so far
+    //!
+    //! \return const std::vector<LzIndexEntry>& - Block index
+    //////////////////////////////////////////////////////////////////////////////////////////
+    const std::vector<LzIndexEntry>& index() const
+    {
+      return Index;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::buffer
+    //! Get the position of the free space within the buffer, for writing directly
+    //!
+    //! \return element_t* - Free space of 'remaining()' bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    element_t* buffer()
+    {
+      return reinterpret_cast<element_t*>(Input.data() + Used);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::release
+    //! Commits bytes written directly into the buffer
+    //!
+    //! \param[in] length - Number of bytes written
+    //!
+    //! \throw wtl::length_error - [Debug only] Exceeds free space
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      Used += length;
+      if (Used >= Threads * BlockSize)
+        compress(Threads);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::put
+    //! Writes a single byte
+    //!
+    //! \param[in] element - Byte
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void put(element_t element)
+    {
+      *buffer() = element;
+      release(1);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::write
+    //! Writes a buffer of bytes
+    //!
+    //! \param[in] const* buf - Buffer
+    //! \param[in] length - Number of bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void write(const ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Compressed streams require single-byte elements");
+
+      for (uint32_t chunk; length; buf += chunk, length -= chunk)
+      {
+        chunk = std::min<uint32_t>(length, static_cast<uint32_t>(remaining()));
+        std::memcpy(Input.data() + Used, buf, chunk);
+        release(chunk);
+      }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::write
+    //! Writes all elements of statically allocated array
+    //!
+    //! \param[in] const (&)[] arr - Statically allocated array of elements
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void write(const element_t (&arr)[LENGTH])
+    {
+      write(arr, LENGTH);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::flush
+    //! Compresses all buffered output, including any partial block, then flushes the output stream
+    //!
+    //! \throw wtl::logic_error - Stream has been closed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      if (Closed)
+        throw wtl::logic_error(HERE, "Stream has been closed");
+
+      compress((Used + BlockSize - 1) / BlockSize);
+      Stream.flush();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::close
+    //! Compresses all buffered output then writes the end marker and block index, and closes the output stream
+    //!
+    //! \throw wtl::logic_error - Stream has been closed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      if (Closed)
+        throw wtl::logic_error(HERE, "Stream has been closed");
+
+      compress((Used + BlockSize - 1) / BlockSize);
+
+      // End marker, index, then index length and magic number
+      const LzBlockHeader end = { 0, 0 };
+      const uint32_t footer[] = { static_cast<uint32_t>(Index.size()), LzIndexMagic };
+      emit(&end, sizeof(end));
+      emit(Index.data(), static_cast<uint32_t>(Index.size() * sizeof(LzIndexEntry)));
+      emit(footer, sizeof(footer));
+
+      Closed = true;
+      Stream.close();
+    }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::compress
+    //! Compresses blocks from the start of the buffer, writes them in order, then moves any remaining
+    //! output to the start of the buffer
+    //!
+    //! \param[in] blocks - Number of blocks to compress  (The last may be partial)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void compress(uint32_t blocks)
+    {
+      const uint32_t bound = lz_compress_bound(BlockSize),
+                     length = std::min(Used, blocks * BlockSize);
+      std::vector<uint32_t> sizes(blocks);
+
+      // Compress block 'idx' into its output slot
+      auto worker = [&] (uint32_t first, uint32_t step)
+      {
+        for (uint32_t idx = first; idx < blocks; idx += step)
+        {
+          uint32_t raw = std::min(BlockSize, length - idx * BlockSize);
+          sizes[idx] = lz_compress(Input.data() + idx * BlockSize, raw, Output.data() + idx * bound, raw);
+        }
+      };
+
+      // Compress concurrently when there's more than one block
+      if (blocks > 1 && Threads > 1)
+      {
+        std::vector<WorkerThread> workers;
+        for (uint32_t idx = 1; idx < std::min(blocks, Threads); ++idx)
+          workers.emplace_back(worker, idx, std::min(blocks, Threads));
+        worker(0, std::min(blocks, Threads));
+
+        for (auto& w : workers)
+          w.join();
+      }
+      else
+        worker(0, 1);
+
+      // Write blocks in order  (Blocks that didn't compress are stored)
+      for (uint32_t idx = 0; idx < blocks; ++idx)
+      {
+        const uint32_t raw = std::min(BlockSize, length - idx * BlockSize);
+        const bool     stored = !sizes[idx];
+        const LzBlockHeader header = { stored ? raw | LzBlockHeader::Stored : sizes[idx], raw };
+
+        Index.push_back(Next);
+        Next.Position += raw;
+
+        emit(&header, sizeof(header));
+        if (stored)
+          emit(Input.data() + idx * BlockSize, raw);
+        else
+          emit(Output.data() + idx * bound, sizes[idx]);
+      }
+
+      // Preserve remainder
+      std::memmove(Input.data(), Input.data() + length, Used - length);
+      Used -= length;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzOutputStream::emit
+    //! Writes bytes to the output stream
+    //!
+    //! \param[in] const* data - Bytes
+    //! \param[in] length - Number of bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void emit(const void* data, uint32_t length)
+    {
+      Stream.write(reinterpret_cast<const element_t*>(data), length);
+      Next.Offset += length;
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LzInputStream - Input stream adapter that decompresses the output of LzOutputStream
+  //!
+  //! \tparam STREAM - Input stream type with single-byte elements
+  //!
+  //! \remarks Blocks are decompressed into a window as they're consumed. Unless the end of the stream has been
+  //! \remarks  reached, the window holds at least one block of unread bytes, so readers may read directly from
+  //! \remarks  buffer(). Blocks are appended after the unread bytes while they fit, otherwise the unread bytes are
+  //! \remarks  first moved to the start of the window. Any release may therefore relocate buffer(), so readers that
+  //! \remarks  hand out views (eg. BinaryReader, TextReader) defer releasing them until their next read.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct LzInputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = LzInputStream<STREAM>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef typename STREAM::distance_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef typename STREAM::element_t element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef typename STREAM::position_t position_t;
+
+    //! \typedef stream_t - Stream type
+    typedef STREAM stream_t;
+
+    static_assert(sizeof(element_t) == 1, "Compressed streams require single-byte elements");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    stream_t           Stream;       //!< Input stream
+    uint32_t           BlockSize;    //!< Maximum length of each uncompressed block, in bytes
+    std::vector<byte>  Window;       //!< Decompressed input
+    uint32_t           Begin,        //!< Position of first unread byte within 'Window'
+                       End;          //!< Position following last decompressed byte within 'Window'
+    std::vector<byte>  Compressed;   //!< Compressed block
+    bool               Finished;     //!< Whether the end marker has been read
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::LzInputStream
+    //! Create the adapter, read the stream header, and decompress the first block
+    //!
+    //! \tparam ARGS... - Stream constructor argument types
+    //!
+    //! \param[in,out] &&... args - Stream constructor arguments
+    //!
+    //! \throw wtl::domain_error - Input is not a compressed stream or is malformed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    LzInputStream(ARGS&&... args)
+      : Stream(std::forward<ARGS>(args)...),
+        BlockSize(0),
+        Begin(0),
+        End(0),
+        Finished(false)
+    {
+      uint32_t header[2];
+      receive(header, sizeof(header));
+
+      if (header[0] != LzStreamMagic || header[1] < 1024 || header[1] > (1u << 30))
+        throw wtl::domain_error(HERE, "Input is not a compressed stream");
+
+      BlockSize = header[1];
+      Window.resize(2 * static_cast<size_t>(BlockSize));
+      Compressed.resize(lz_compress_bound(BlockSize));
+      refill();
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(LzInputStream);      //!< Cannot be copied
+    ENABLE_MOVE(LzInputStream);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::remaining() const
+    //! Get the number of decompressed bytes available for reading directly
+    //!
+    //! \return distance_t - Unread bytes within the window  (At least one block unless the stream has ended)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(End - Begin);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::buffer
+    //! Get the position of the first unread byte, for reading directly
+    //!
+    //! \return const element_t* - Unread bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    const element_t* buffer() const
+    {
+      return reinterpret_cast<const element_t*>(Window.data() + Begin);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::release
+    //! Consumes bytes read directly from the buffer
+    //!
+    //! \param[in] length - Number of bytes read
+    //!
+    //! \throw wtl::domain_error - Next block is malformed
+    //! \throw wtl::length_error - [Debug only] Exceeds unread bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      Begin += length;
+      refill();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::get
+    //! Reads a single byte
+    //!
+    //! \return element_t - Byte
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is malformed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    element_t get()
+    {
+      if (Begin == End)
+        throw wtl::domain_error(HERE, "Compressed stream has ended");
+
+      element_t element = *buffer();
+      release(1);
+      return element;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::read
+    //! Reads a buffer of bytes, spanning blocks if necessary
+    //!
+    //! \param[in,out] *buf - Buffer
+    //! \param[in] length - Number of bytes
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is malformed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void read(ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Compressed streams require single-byte elements");
+
+      for (uint32_t chunk; length; buf += chunk, length -= chunk)
+      {
+        if (Begin == End)
+          throw wtl::domain_error(HERE, "Compressed stream has ended");
+
+        chunk = std::min(length, End - Begin);
+        std::memcpy(buf, Window.data() + Begin, chunk);
+        release(chunk);
+      }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::read
+    //! Reads all elements of statically allocated array
+    //!
+    //! \param[in,out] (&)[] arr - Statically allocated array of elements
+    //!
+    //! \throw wtl::domain_error - Stream has ended or next block is malformed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void read(element_t (&arr)[LENGTH])
+    {
+      read(arr, LENGTH);
+    }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::refill
+    //! Decompresses the next block once less than a block remains unread, after the unread bytes while it fits
+    //!
+    //! \throw wtl::domain_error - Block is malformed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void refill()
+    {
+      if (Finished || End - Begin >= BlockSize)
+        return;
+
+      // Move unread bytes to the start of the window only when another block won't fit after them
+      if (End + BlockSize > Window.size())
+      {
+        std::memmove(Window.data(), Window.data() + Begin, End - Begin);
+        End -= Begin;
+        Begin = 0;
+      }
+
+      LzBlockHeader header;
+      receive(&header, sizeof(header));
+
+      // [END] Ignore index
+      if (!header.Size && !header.Length)
+      {
+        Finished = true;
+        return;
+      }
+
+      const uint32_t size = header.Size & ~LzBlockHeader::Stored;
+      if (header.Length > BlockSize || size > Compressed.size() || (header.Size & LzBlockHeader::Stored && size != header.Length))
+        throw wtl::domain_error(HERE, "Malformed compressed block header");
+
+      // Stored blocks are read directly into the window
+      if (header.Size & LzBlockHeader::Stored)
+        receive(Window.data() + End, size);
+      else
+      {
+        receive(Compressed.data(), size);
+        if (lz_decompress(Compressed.data(), size, Window.data() + End, header.Length) != header.Length)
+          throw wtl::domain_error(HERE, "Compressed block length mismatch");
+      }
+      End += header.Length;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzInputStream::receive
+    //! Reads bytes from the input stream
+    //!
+    //! \param[in,out] *data - Buffer
+    //! \param[in] length - Number of bytes
+    //!
+    //! \throw wtl::domain_error - Input stream is truncated
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void receive(void* data, uint32_t length)
+    {
+      if (Stream.remaining() < static_cast<distance_t>(length))
+        throw wtl::domain_error(HERE, "Truncated compressed stream");
+
+      Stream.read(reinterpret_cast<element_t*>(data), length);
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LzArchive - Provides random access to the blocks of a compressed stream held in memory
+  //!
+  //! \remarks Blocks are independent, so any block can be decompressed (on any thread) using the index
+  //! \remarks  written by LzOutputStream::close()
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct LzArchive
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    const byte*          Data;         //!< Compressed stream
+    uint64_t             Length;       //!< Length of compressed stream, in bytes
+    uint32_t             BlockSize;    //!< Maximum length of each uncompressed block, in bytes
+    const LzIndexEntry*  Index;        //!< Block index  (Possibly unaligned)
+    uint32_t             Blocks;       //!< Number of blocks
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::LzArchive
+    //! Locates the block index of a complete compressed stream
+    //!
+    //! \param[in] const* data - Compressed stream
+    //! \param[in] length - Length of compressed stream, in bytes
+    //!
+    //! \throw wtl::domain_error - Input is not a complete compressed stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    LzArchive(const byte* data, uint64_t length) : Data(data), Length(length)
+    {
+      const uint64_t minimum = 2 * sizeof(uint32_t) + sizeof(LzBlockHeader) + 2 * sizeof(uint32_t);
+      if (length < minimum || lz_read32(data) != LzStreamMagic || lz_read32(data + length - 4) != LzIndexMagic)
+        throw wtl::domain_error(HERE, "Input is not a complete compressed stream");
+
+      BlockSize = lz_read32(data + 4);
+      Blocks = lz_read32(data + length - 8);
+      if (Blocks > (length - minimum) / sizeof(LzIndexEntry))
+        throw wtl::domain_error(HERE, "Malformed compressed stream index");
+
+      Index = reinterpret_cast<const LzIndexEntry*>(data + length - 8 - Blocks * sizeof(LzIndexEntry));
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::blocks() const
+    //! Get the number of blocks
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t blocks() const
+    {
+      return Blocks;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::blockSize() const
+    //! Get the maximum length of each uncompressed block, in bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t blockSize() const
+    {
+      return BlockSize;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::entry() const
+    //! Get the location of a block
+    //!
+    //! \param[in] idx - Block index
+    //! \return LzIndexEntry - Location of block within the compressed and decompressed streams
+    //!
+    //! \throw wtl::out_of_range - Invalid block index
+    //////////////////////////////////////////////////////////////////////////////////////////
+    LzIndexEntry entry(uint32_t idx) const
+    {
+      if (idx >= Blocks)
+        throw wtl::out_of_range(HERE, "Block ", idx, " does not exist");
+
+      LzIndexEntry e;
+      std::memcpy(&e, reinterpret_cast<const byte*>(Index) + idx * sizeof(LzIndexEntry), sizeof(e));
+      return e;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::find() const
+    //! Find the block containing a position within the decompressed stream
+    //!
+    //! \param[in] position - Position within the decompressed stream
+    //! \return uint32_t - Block index, or blocks() if beyond the end
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t find(uint64_t position) const
+    {
+      uint32_t first = 0, last = Blocks;
+
+      // Binary search for the last block starting at or before 'position'
+      while (first < last)
+      {
+        uint32_t middle = first + (last - first) / 2;
+        if (entry(middle).Position <= position)
+          first = middle + 1;
+        else
+          last = middle;
+      }
+
+      if (!first)
+        return Blocks;
+
+      // Ensure position is within the block
+      uint32_t idx = first - 1;
+      LzBlockHeader header = this->header(idx);
+      return position < entry(idx).Position + header.Length ? idx : Blocks;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::read() const
+    //! Decompresses a block
+    //!
+    //! \param[in] idx - Block index
+    //! \param[in,out] *output - Buffer of at least blockSize() bytes
+    //! \return uint32_t - Length of decompressed block
+    //!
+    //! \throw wtl::domain_error - Block is malformed
+    //! \throw wtl::out_of_range - Invalid block index
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t read(uint32_t idx, byte* output) const
+    {
+      LzBlockHeader header = this->header(idx);
+      const byte*   data = Data + entry(idx).Offset + sizeof(LzBlockHeader);
+      uint32_t      size = header.Size & ~LzBlockHeader::Stored;
+
+      if (header.Length > BlockSize || static_cast<uint64_t>(data - Data) + size > Length)
+        throw wtl::domain_error(HERE, "Malformed compressed block header");
+
+      // Copy stored blocks verbatim
+      if (header.Size & LzBlockHeader::Stored)
+      {
+        if (size != header.Length)
+          throw wtl::domain_error(HERE, "Malformed compressed block header");
+        std::memcpy(output, data, size);
+        return size;
+      }
+
+      if (lz_decompress(data, size, output, header.Length) != header.Length)
+        throw wtl::domain_error(HERE, "Compressed block length mismatch");
+      return header.Length;
+    }
+
+  protected:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // LzArchive::header() const
+    //! Get the header of a block
+    //!
+    //! \param[in] idx - Block index
+    //! \return LzBlockHeader - Block header
+    //!
+    //! \throw wtl::domain_error - Block header lies outside the stream
+    //! \throw wtl::out_of_range - Invalid block index
+    //////////////////////////////////////////////////////////////////////////////////////////
+    LzBlockHeader header(uint32_t idx) const
+    {
+      uint64_t offset = entry(idx).Offset;
+      if (offset + sizeof(LzBlockHeader) > Length)
+        throw wtl::domain_error(HERE, "Malformed compressed stream index");
+
+      LzBlockHeader h;
+      std::memcpy(&h, Data + offset, sizeof(h));
+      return h;
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_LZ_STREAM_HPP
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\MappedFile.hpp
+//! \brief Provides read-only memory-mapped access to files
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_MAPPED_FILE_HPP
+#define WTL_MAPPED_FILE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/WinAPI.h>                       //!< WinAPI
+#include <wtl/utils/Path.hpp>                 //!< Path
+#include <wtl/utils/ScopeGuard.hpp>           //!< BasicScopeGuard
+#include <memory>                             //!< std::shared_ptr
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct MappedFile - Read-only view of an entire file, mapped into memory
+  //!
+  //! \remarks Copies share the view, which is unmapped when the last copy is destroyed. Pages are loaded on demand
+  //! \remarks  by the memory manager, so mapping a large file is cheap until its contents are touched.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct MappedFile
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<const byte>  View;      //!< Mapped view  (Empty for zero-length files)
+    uint64_t                     Size;      //!< Length of file, in bytes
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedFile::MappedFile
+    //! Map an existing file
+    //!
+    //! \tparam ENC - Path character encoding
+    //!
+    //! \param[in] const& path - Full path of file
+    //!
+    //! \throw wtl::platform_error - Unable to open or map file
+    //! \throw wtl::length_error - File too large for the address space
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <Encoding ENC>
+    explicit
+    MappedFile(const Path<ENC>& path) : Size(0)
+    {
+      // Open file, permitting concurrent readers and writers
+      ::HANDLE file = WinAPI<ENC>::createFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+        throw platform_error(HERE, "Unable to open file");
+      BasicScopeGuard closeFile = [file] { ::CloseHandle(file); };
+
+      ::LARGE_INTEGER length;
+      if (!::GetFileSizeEx(file, &length))
+        throw platform_error(HERE, "Unable to query file size");
+
+      // [EMPTY] Zero-length files cannot be mapped
+      if ((Size = static_cast<uint64_t>(length.QuadPart)) == 0)
+        return;
+
+      if (Size > SIZE_MAX)
+        throw wtl::length_error(HERE, "File of ", Size, " bytes exceeds the address space");
+
+      // Map entire file; the view retains the mapping once both handles are closed
+      ::HANDLE mapping = WinAPI<ENC>::createFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (!mapping)
+        throw platform_error(HERE, "Unable to create file mapping");
+      BasicScopeGuard closeMapping = [mapping] { ::CloseHandle(mapping); };
+
+      const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (!view)
+        throw platform_error(HERE, "Unable to map view of file");
+
+      View.reset(static_cast<const byte*>(view), [] (const byte* v) { ::UnmapViewOfFile(v); });
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(MappedFile);      //!< Can be shallow copied
+    ENABLE_MOVE(MappedFile);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedFile::data const
+    //! Get the file contents
+    //!
+    //! \return const byte* - Mapped contents, or nullptr if the file is empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const byte* data() const
+    {
+      return View.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedFile::size const
+    //! Get the length of the file
+    //!
+    //! \return uint64_t - Length, in bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t size() const
+    {
+      return Size;
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_MAPPED_FILE_HPP
@@ -0,0 +1,275 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\Resolver.hpp
+//! \brief Provides host name resolution with a local cache
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_RESOLVER_HPP
+#define WTL_RESOLVER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Socket.hpp>                  //!< Socket
+#include <wtl/utils/String.hpp>               //!< String
+#include <ws2tcpip.h>                         //!< getaddrinfo
+#include <algorithm>                          //!< std::none_of
+#include <atomic>                             //!< std::atomic
+#include <chrono>                             //!< std::chrono
+#include <cstring>                            //!< std::memcmp
+#include <mutex>                              //!< std::mutex
+#include <string>                             //!< std::string
+#include <unordered_map>                      //!< std::unordered_map
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Resolver - Resolves host names to socket addresses, caching the results
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks getaddrinfo doesn't expose record TTLs, so successful lookups are cached for a fixed period and failed
+  //! \remarks  lookups for a shorter one. Static entries, such as those read from a hosts file, never expire.
+  //! \remarks  Lookups are thread-safe; concurrent misses for the same host may each query getaddrinfo.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct Resolver
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = Resolver<FAMILY>;
+
+    //! \alias address_t - Socket address type
+    using address_t = typename Socket<FAMILY>::address_t;
+
+    //! \alias clock_t - Expiry clock
+    using clock_t = std::chrono::steady_clock;
+
+    //! \alias addresses_t - Resolved addresses
+    using addresses_t = std::vector<address_t>;
+
+  protected:
+    //! \struct Entry - Cached lookup
+    struct Entry
+    {
+      addresses_t          Addresses;     //!< Addresses, without port  (Empty if lookup failed)
+      int32_t              Error;         //!< Error of a failed lookup
+      clock_t::time_point  Expires;       //!< Expiry time
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                     Mutex;              //!< Guards 'Cache'
+    std::unordered_map<std::string,Entry>  Cache;              //!< Lookups by host name
+    clock_t::duration                      Lifetime,           //!< Lifetime of successful lookups
+                                           NegativeLifetime;   //!< Lifetime of failed lookups
+    std::atomic<uint64_t>                  Hits,               //!< Number of lookups answered from cache
+                                           Misses;             //!< Number of lookups that queried getaddrinfo
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::Resolver
+    //! Create empty resolver
+    //!
+    //! \param[in] lifetime - [optional] Lifetime of successful lookups
+    //! \param[in] negative - [optional] Lifetime of failed lookups
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    Resolver(clock_t::duration lifetime = std::chrono::seconds(60), clock_t::duration negative = std::chrono::seconds(5))
+      : Lifetime(lifetime), NegativeLifetime(negative), Hits(0), Misses(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(Resolver);     //!< Cannot be copied
+    DISABLE_MOVE(Resolver);     //!< Cannot be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::hits const
+    //! Get the number of lookups answered from the cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t hits() const
+    {
+      return Hits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::misses const
+    //! Get the number of lookups that queried getaddrinfo
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t misses() const
+    {
+      return Misses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::size const
+    //! Get the number of cached host names, including expired entries not yet replaced
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return Cache.size();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::clear
+    //! Discards every cached lookup, including static entries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Cache.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::erase
+    //! Discards the cached lookup of a host, forcing the next lookup to query getaddrinfo
+    //!
+    //! \param[in] const& host - Host name
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void erase(const String<Encoding::ANSI>& host)
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Cache.erase(host.c_str());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::insert
+    //! Inserts a static entry, in the manner of a hosts file
+    //!
+    //! \param[in] const& host - Host name
+    //! \param[in] const& addresses - Addresses  (Ports are ignored)
+    //! \param[in] lifetime - [optional] Lifetime of entry, which by default never expires
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void insert(const String<Encoding::ANSI>& host, const addresses_t& addresses, clock_t::duration lifetime = clock_t::duration::max())
+    {
+      const clock_t::time_point now = clock_t::now(),
+                                expires = lifetime < clock_t::time_point::max() - now ? now + lifetime : clock_t::time_point::max();
+
+      std::lock_guard<std::mutex> lock(Mutex);
+      Cache[host.c_str()] = Entry { addresses, 0, expires };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::resolve
+    //! Resolves a host name, or a numeric address, to the addresses of a port
+    //!
+    //! \param[in] const& host - Host name or numeric address
+    //! \param[in] port - Port (in host byte order)
+    //! \return addresses_t - Addresses in the order returned by getaddrinfo, which ranks them by preference
+    //!
+    //! \throw wtl::socket_error - Unable to resolve host  (Failures are cached too)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    addresses_t resolve(const String<Encoding::ANSI>& host, uint16_t port)
+    {
+      addresses_t addresses;
+      int32_t error = 0;
+
+      // [HIT] Copy unexpired entry
+      if (!lookup(host.c_str(), addresses, error))
+      {
+        ++Misses;
+        error = query(host.c_str(), addresses);
+
+        std::lock_guard<std::mutex> lock(Mutex);
+        Cache[host.c_str()] = Entry { addresses, error, clock_t::now() + (error ? NegativeLifetime : Lifetime) };
+      }
+      else
+        ++Hits;
+
+      if (error)
+      {
+        ::WSASetLastError(error);
+        throw socket_error(HERE, "Unable to resolve host: " + host);
+      }
+
+      // Apply port
+      for (address_t& addr : addresses)
+        port_of(addr) = ::htons(port);
+      return addresses;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::lookup
+    //! Retrieves an unexpired cached lookup
+    //!
+    //! \param[in] const& host - Host name
+    //! \param[out] &addresses - Addresses
+    //! \param[out] &error - Error of a failed lookup
+    //! \return bool - True iff found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool lookup(const std::string& host, addresses_t& addresses, int32_t& error) const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      auto pos = Cache.find(host);
+      if (pos == Cache.end() || pos->second.Expires <= clock_t::now())
+        return false;
+
+      addresses = pos->second.Addresses;
+      error = pos->second.Error;
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::port_of
+    //! Get the port of an address
+    //!
+    //! \param[in,out] &addr - Address
+    //! \return ::USHORT& - Port (in network byte order)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static ::USHORT& port_of(SOCKADDR_IN& addr)
+    {
+      return addr.sin_port;
+    }
+
+#if (NTDDI_VERSION >= NTDDI_VISTA)
+    static ::USHORT& port_of(SOCKADDR_IN6& addr)
+    {
+      return addr.sin6_port;
+    }
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Resolver::query
+    //! Queries getaddrinfo for the stream addresses of a host
+    //!
+    //! \param[in] const& host - Host name
+    //! \param[out] &addresses - Distinct addresses
+    //! \return int32_t - Zero if successful, otherwise the error
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static int32_t query(const std::string& host, addresses_t& addresses)
+    {
+      ::ADDRINFOA hints {}, *results = nullptr;
+      hints.ai_family = enum_cast(FAMILY);
+      hints.ai_socktype = SOCK_STREAM;
+
+      if (int32_t error = ::getaddrinfo(host.c_str(), nullptr, &hints, &results))
+        return error;
+
+      // Collect addresses, discarding duplicates
+      for (const ::ADDRINFOA* r = results; r; r = r->ai_next)
+        if (r->ai_family == enum_cast(FAMILY) && r->ai_addrlen >= sizeof(address_t))
+        {
+          const address_t& addr = *reinterpret_cast<const address_t*>(r->ai_addr);
+          if (std::none_of(addresses.begin(), addresses.end(), [&addr] (const address_t& a) { return std::memcmp(&a, &addr, sizeof(address_t)) == 0; }))
+            addresses.push_back(addr);
+        }
+
+      ::freeaddrinfo(results);
+      return addresses.empty() ? WSAHOST_NOT_FOUND : 0;
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_RESOLVER_HPP
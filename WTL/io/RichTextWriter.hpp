@@ -10,12 +10,106 @@
 #define WTL_RICH_TEXT_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/io/Scanner.hpp>           //!< ByteTable
+#include <wtl/utils/ByteSearch.hpp>     //!< WTL_SSE2, lowest_bit
+#include <cstring>                      //!< strlen
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
   enum class Alignment { Left, Centre, Right, Justify };
 
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct RtfEscape - Control word that replaces a character
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct RtfEscape
+  {
+    char     Text[7];     //!< Control word  (not null terminated)
+    uint8_t  Length;      //!< Length of control word, or zero if the character needs no escaping
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::rtf_escape constexpr
+  //! Generates the control word that replaces a character
+  //!
+  //! \param[in] c - Byte value
+  //! \return RtfEscape - Braces and backslash are escaped, line-feed and tab are replaced by control words,
+  //!                     and non-ASCII bytes are written in hex  (\'hh)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr RtfEscape rtf_escape(size_t c)
+  {
+    return c == '{'  ? RtfEscape { {'\\','{'}, 2 }
+         : c == '}'  ? RtfEscape { {'\\','}'}, 2 }
+         : c == '\\' ? RtfEscape { {'\\','\\'}, 2 }
+         : c == '\n' ? RtfEscape { {'\\','l','i','n','e',' '}, 6 }
+         : c == '\t' ? RtfEscape { {'\\','t','a','b',' '}, 5 }
+         : c >= 0x80 ? RtfEscape { {'\\','\'', "0123456789abcdef"[c >> 4], "0123456789abcdef"[c & 0x0f]}, 4 }
+         :             RtfEscape { {}, 0 };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::generate_rtf_escapes constexpr
+  //! Generates the control word of every byte value
+  //!
+  //! \tparam IDX... - Byte values
+  //!
+  //! \return ByteTable<RtfEscape> - Escape table
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <size_t... IDX>
+  constexpr ByteTable<RtfEscape> generate_rtf_escapes(std::index_sequence<IDX...>)
+  {
+    return ByteTable<RtfEscape> { { rtf_escape(IDX)... } };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct rtf_escapes - Compile-time table of control words
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename = void>
+  struct rtf_escapes
+  {
+    static constexpr ByteTable<RtfEscape> Table = generate_rtf_escapes(std::make_index_sequence<256>());    //!< Control word of each byte value
+  };
+
+  //! Define static table
+  template <typename T>
+  constexpr ByteTable<RtfEscape> rtf_escapes<T>::Table;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::find_rtf_escape
+  //! Finds the first character that must be escaped, examining 16 characters per iteration where possible
+  //!
+  //! \param[in] const* pos - First character
+  //! \param[in] const* end - Position beyond last character
+  //! \return const char* - Position of first brace, backslash, line-feed, tab or non-ASCII byte, otherwise 'end'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline const char* find_rtf_escape(const char* pos, const char* end) noexcept
+  {
+#if WTL_SSE2
+    const __m128i open = _mm_set1_epi8('{'),
+                  close = _mm_set1_epi8('}'),
+                  backslash = _mm_set1_epi8('\\'),
+                  newline = _mm_set1_epi8('\n'),
+                  tab = _mm_set1_epi8('\t');
+
+    // Compare blocks of 16 bytes; the sign bit identifies non-ASCII bytes
+    for (; end - pos >= 16; pos += 16)
+    {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)),
+              special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, open), _mm_cmpeq_epi8(block, close)),
+                                     _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, backslash), _mm_cmpeq_epi8(block, newline)),
+                                                  _mm_cmpeq_epi8(block, tab)));
+      if (int mask = _mm_movemask_epi8(_mm_or_si128(special, block)))
+        return pos + lowest_bit(static_cast<uint32_t>(mask));
+    }
+#endif
+    // Examine remaining bytes
+    for (; pos != end; ++pos)
+      if (rtf_escapes<>::Table[*pos].Length)
+        return pos;
+
+    return end;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////
 	//! \struct RichTextWriter - Writes rich text to an output stream
   //! 
@@ -419,41 +513,24 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void   write(element_t ch)
     {
-      element_t buf[10];
-
       // Check stream is open
       if (Closed)
         throw wtl::logic_error(HERE, "Writer is closed");
 
-      // Escape/Convert char:
-      switch (ch)
-      {
-      case '{':
-      case '}':
-        writeChar('\\');
+      // Write character verbatim, or its control word
+      const RtfEscape esc = rtf_escapes<>::Table[ch];
+      if (!esc.Length)
         writeChar(ch);
-        break;
-
-      case '\\': writeString("\\\\");     break;
-      case '\n': writeString("\\line ");  break;
-      case '\t': writeString("\\tab ");   break;
-
-      default:
-        // ANSI char:
-        if (ch <= 0x7f)
-          writeChar(ch);
-        else
-        {  // UNICODE char:
-          StringCchPrintfA(buf, 10, "\\u%u?", (uint32_t)ch);
-          writeString(buf);
-        }
-        break;
+      else
+      {
+        Stream.write(esc.Text, esc.Length);
+        flush(esc.Length);
       }
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
     // RtfWriter::write
-    //! Writes text to the stream 
+    //! Writes text to the stream, writing each run of characters that need no escaping with a single call
     //! 
     //! \param[in] const* str - The text
     //! 
@@ -466,9 +543,27 @@ namespace wtl
       if (Closed)
         throw wtl::logic_error(HERE, "Writer is closed");
     
-      // Write characters
-      for (const element_t* chr = str; *chr; ++chr)
-        write(*chr);
+      for (const element_t *pos = str, *end = str + strlen(str); pos != end; )
+      {
+        const element_t* special = find_rtf_escape(pos, end);
+
+        // Write run verbatim
+        if (special != pos)
+        {
+          Stream.write(pos, static_cast<int>(special - pos));
+          flush(static_cast<int>(special - pos));
+        }
+
+        // Write control word
+        if (special != end)
+        {
+          const RtfEscape esc = rtf_escapes<>::Table[*special];
+          Stream.write(esc.Text, esc.Length);
+          flush(esc.Length);
+          ++special;
+        }
+        pos = special;
+      }
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,670 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\RpcChannel.hpp
+//! \brief Provides a multiplexed request/response protocol over framed socket connections
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_RPC_CHANNEL_HPP
+#define WTL_RPC_CHANNEL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/FrameCodec.hpp>              //!< FrameDecoder, append_frame
+#include <wtl/io/SocketReactor.hpp>           //!< SocketReactor
+#include <atomic>                             //!< std::atomic
+#include <climits>                            //!< INT_MAX
+#include <functional>                         //!< std::function
+#include <future>                             //!< std::future
+#include <memory>                             //!< std::shared_ptr
+#include <mutex>                              //!< std::mutex
+#include <unordered_map>                      //!< std::unordered_map
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum RpcStatus - Outcome of a remote call
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class RpcStatus : uint32_t
+  {
+    Success = 0,          //!< Response holds the result
+    UnknownMethod = 1,    //!< Server has no handler for the method
+    Failed = 2,           //!< Handler threw; response holds the exception message
+    Disconnected = 3,     //!< Connection closed before the response arrived
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::rpc_append
+  //! Appends an RPC message to an output buffer as a single frame
+  //!
+  //! \param[in,out] &output - Output buffer
+  //! \param[in] id - Request id
+  //! \param[in] code - Method of a request, or RpcStatus of a response
+  //! \param[in] const* body - Message body
+  //! \param[in] length - Length of body, in bytes
+  //!
+  //! \remarks Messages are encoded as a frame whose payload holds the request id and code as varints, then the body
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline void rpc_append(std::vector<byte>& output, uint64_t id, uint32_t code, const byte* body, uint32_t length)
+  {
+    byte header[2 * VarIntMaxLength];
+    uint32_t size = varint_encode(id, header);
+    size += varint_encode(code, header + size);
+
+    byte frame[VarIntMaxLength];
+    uint32_t prefix = varint_encode(size + length, frame);
+
+    output.insert(output.end(), frame, frame + prefix);
+    output.insert(output.end(), header, header + size);
+    output.insert(output.end(), body, body + length);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::rpc_decode
+  //! Decodes an RPC message from a frame payload
+  //!
+  //! \param[in] const* payload - Frame payload
+  //! \param[in] length - Length of payload
+  //! \param[out] &id - Request id
+  //! \param[out] &code - Method of a request, or RpcStatus of a response
+  //! \return uint32_t - Length of the message header; the body follows it
+  //!
+  //! \throw wtl::domain_error - Malformed message
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t rpc_decode(const byte* payload, uint32_t length, uint64_t& id, uint64_t& code)
+  {
+    uint32_t first = varint_decode(payload, payload + length, id),
+             second = first ? varint_decode(payload + first, payload + length, code) : 0;
+
+    if (!second || code > UINT32_MAX)
+      throw wtl::domain_error(HERE, "Malformed RPC message");
+
+    return first + second;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::rpc_send
+  //! Sends as much buffered output as a non-blocking socket accepts
+  //!
+  //! \param[in] s - Non-blocking socket
+  //! \param[in,out] &output - Output buffer, emptied once sent
+  //! \param[in,out] &offset - Position of first unsent byte
+  //! \return bool - True if all output was sent, false if the socket would block
+  //!
+  //! \throw wtl::socket_error - Failed to send
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline bool rpc_send(::SOCKET s, std::vector<byte>& output, size_t& offset)
+  {
+    while (offset < output.size())
+    {
+      const int chunk = static_cast<int>(std::min<size_t>(output.size() - offset, INT_MAX));
+      const int n = ::send(s, reinterpret_cast<const char*>(output.data() + offset), chunk, 0);
+
+      // [WOULD-BLOCK] Resume once writable
+      if (n == SOCKET_ERROR)
+      {
+        if (::WSAGetLastError() == WSAEWOULDBLOCK)
+          return false;
+
+        throw socket_error(HERE, "Unable to send RPC messages");
+      }
+      offset += n;
+    }
+
+    output.clear();
+    offset = 0;
+    return true;
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct RpcServer - Serves remote calls upon connections accepted by a listening socket
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Connections are serviced by a SocketReactor, which must outlive the server. Handlers run upon the
+  //! \remarks  reactor thread in the order requests arrive, and every response produced from one read is sent with
+  //! \remarks  a single call. Clients may therefore pipeline many requests per connection.
+  //! \remarks
+  //! \remarks Once the unsent responses of a connection exceed 'HighWaterMark', its requests are not read until they
+  //! \remarks  have been sent, so a client that pipelines requests without reading responses cannot exhaust memory.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct RpcServer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = RpcServer<FAMILY>;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+    //! \alias handler_t - Method handler; appends its result to the response, or throws to fail the call
+    using handler_t = std::function<void (const byte* request, uint32_t length, std::vector<byte>& response)>;
+
+    //! \var HighWaterMark - Number of unsent response bytes above which a connection stops reading requests
+    static constexpr size_t HighWaterMark = 1024 * 1024;
+
+  protected:
+    //! \struct Connection - Client connection  (Accessed only upon the reactor thread)
+    struct Connection
+    {
+      socket_t           Socket;        //!< Connected socket
+      FrameDecoder       Decoder;       //!< Request reassembly
+      std::vector<byte>  Output;        //!< Unsent responses
+      size_t             Offset;        //!< Position of first unsent byte within 'Output'
+      SocketEvent        Interest;      //!< Notifications currently requested from the reactor
+    };
+
+    //! \struct State - Server state shared with reactor callbacks
+    struct State
+    {
+      SocketReactor*                                     Reactor;       //!< Reactor servicing connections
+      HSocket                                            Listener;      //!< Listening socket
+      std::mutex                                         Mutex;         //!< Guards 'Handlers'
+      std::unordered_map<uint32_t,std::shared_ptr<const handler_t>> Handlers;  //!< Method handlers
+      std::unordered_map<::SOCKET,std::shared_ptr<Connection>> Connections;  //!< Open connections  (Reactor thread only)
+      std::vector<byte>                                  Input,         //!< Receive buffer  (Reactor thread only)
+                                                         Response;      //!< Handler output  (Reactor thread only)
+      std::atomic<uint64_t>                              Requests;      //!< Number of requests served
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<State>  Shared;     //!< Shared state
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::RpcServer
+    //! Accept connections upon a listening socket
+    //!
+    //! \param[in,out] &reactor - Reactor that services connections
+    //! \param[in,out] &listener - Bound, listening socket
+    //!
+    //! \throw wtl::socket_error - Unable to make listener non-blocking
+    /////////////////////////////////////////////////////////////////////////////////////////
+    RpcServer(SocketReactor& reactor, socket_t& listener) : Shared(std::make_shared<State>())
+    {
+      Shared->Reactor = &reactor;
+      Shared->Listener = listener.handle();
+      Shared->Input.resize(64 * 1024);
+      Shared->Requests = 0;
+
+      std::shared_ptr<State> state = Shared;
+      reactor.add(listener, SocketEvent::Accept, [state, listener] (::SOCKET, SocketEvent) mutable { accept(state, listener); });
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(RpcServer);      //!< Cannot be copied
+    ENABLE_MOVE(RpcServer);       //!< Can be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::~RpcServer
+    //! Stops accepting connections and closes every connection, discarding unsent responses
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~RpcServer()
+    {
+      if (std::shared_ptr<State> state = Shared)
+        state->Reactor->post([state] {
+          state->Reactor->remove(state->Listener);
+          for (auto& c : state->Connections)
+            state->Reactor->remove(c.second->Socket.handle());
+          state->Connections.clear();
+        });
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::requests const
+    //! Get the number of requests served
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t requests() const
+    {
+      return Shared->Requests;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::on
+    //! Registers the handler of a method, replacing any existing handler
+    //!
+    //! \param[in] method - Method
+    //! \param[in] const& handler - Handler, invoked upon the reactor thread
+    //!
+    //! \remarks Takes effect immediately, including for requests already received but not yet dispatched. Handlers
+    //! \remarks  may register others.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void on(uint32_t method, const handler_t& handler)
+    {
+      auto entry = std::make_shared<const handler_t>(handler);
+
+      std::lock_guard<std::mutex> lock(Shared->Mutex);
+      Shared->Handlers[method] = std::move(entry);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::accept
+    //! Accepts pending connections
+    //!
+    //! \param[in] const& state - Server state
+    //! \param[in,out] &listener - Listening socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void accept(const std::shared_ptr<State>& state, socket_t& listener)
+    {
+      for (socket_t client = listener.accept(); client.handle().exists(); client = listener.accept())
+      {
+        auto c = std::make_shared<Connection>(Connection { client, FrameDecoder(), {}, 0, SocketEvent::Read });
+        state->Connections[client.handle()] = c;
+        state->Reactor->add(c->Socket, SocketEvent::Read, [state, c] (::SOCKET, SocketEvent ev) { service(*state, *c, ev); });
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::disconnect
+    //! Closes a connection
+    //!
+    //! \param[in,out] &s - Server state
+    //! \param[in,out] &c - Connection
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void disconnect(State& s, Connection& c)
+    {
+      s.Reactor->remove(c.Socket.handle());
+      s.Connections.erase(c.Socket.handle());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::dispatch
+    //! Invokes the handler of a request and appends its response
+    //!
+    //! \param[in,out] &s - Server state
+    //! \param[in,out] &c - Connection
+    //! \param[in] const* payload - Request frame payload
+    //! \param[in] length - Length of payload
+    //!
+    //! \throw wtl::domain_error - Malformed request
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void dispatch(State& s, Connection& c, const byte* payload, uint32_t length)
+    {
+      uint64_t id, method;
+      uint32_t header = rpc_decode(payload, length, id, method);
+      ++s.Requests;
+
+      // Lookup handler, then invoke it without the lock in case it registers another
+      std::shared_ptr<const handler_t> handler;
+      {
+        std::lock_guard<std::mutex> lock(s.Mutex);
+        auto entry = s.Handlers.find(static_cast<uint32_t>(method));
+        if (entry != s.Handlers.end())
+          handler = entry->second;
+      }
+
+      // [UNKNOWN] Fail request
+      if (!handler)
+        return rpc_append(c.Output, id, enum_cast(RpcStatus::UnknownMethod), nullptr, 0);
+
+      try
+      {
+        s.Response.clear();
+        (*handler)(payload + header, length - header, s.Response);
+        rpc_append(c.Output, id, enum_cast(RpcStatus::Success), s.Response.data(), static_cast<uint32_t>(s.Response.size()));
+      }
+      catch (std::exception& e)
+      {
+        const std::string msg = e.what();
+        rpc_append(c.Output, id, enum_cast(RpcStatus::Failed), reinterpret_cast<const byte*>(msg.data()), static_cast<uint32_t>(msg.size()));
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcServer::service
+    //! Reads requests from a connection and sends their responses as one batch. Reading is paused while the
+    //! unsent responses exceed the high-water mark.
+    //!
+    //! \param[in,out] &s - Server state
+    //! \param[in,out] &c - Connection
+    //! \param[in] ev - Readiness
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void service(State& s, Connection& c, SocketEvent ev)
+    {
+      try
+      {
+        if (enum_cast(ev & (SocketEvent::Read|SocketEvent::Close)) != 0)
+        {
+          int n = ::recv(c.Socket.handle(), reinterpret_cast<char*>(s.Input.data()), static_cast<int>(s.Input.size()), 0);
+
+          // [CLOSED/FAILED] Drop connection
+          if (n == 0 || (n == SOCKET_ERROR && ::WSAGetLastError() != WSAEWOULDBLOCK))
+            return disconnect(s, c);
+
+          if (n > 0)
+            c.Decoder.feed(s.Input.data(), n, [&] (const byte* payload, uint32_t length) { dispatch(s, c, payload, length); });
+        }
+
+        // Send responses, waiting for writability only while output remains
+        const bool drained = rpc_send(c.Socket.handle(), c.Output, c.Offset);
+
+        // [BACKPRESSURE] Stop reading requests above the high-water mark, until every response has been sent
+        SocketEvent interest = SocketEvent::Read;
+        if (!drained)
+          interest = c.Interest == SocketEvent::Write || c.Output.size() - c.Offset > HighWaterMark ? SocketEvent::Write 
+                                                                                                   : SocketEvent::Read|SocketEvent::Write;
+        if (interest != c.Interest)
+        {
+          c.Interest = interest;
+          s.Reactor->modify(c.Socket.handle(), interest);
+        }
+      }
+      catch (wtl::domain_error&)
+      {
+        // [MALFORMED] Drop connection
+        disconnect(s, c);
+      }
+      catch (socket_error&)
+      {
+        disconnect(s, c);
+      }
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct RpcClient - Issues remote calls over a single connection, with many calls in flight
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Calls may be issued from any thread. Requests issued before the reactor thread next runs are sent
+  //! \remarks  together with a single call, and responses are matched to their requests by id, so a slow call never
+  //! \remarks  delays the requests queued behind it. The reactor must outlive the client.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct RpcClient
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = RpcClient<FAMILY>;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+    //! \alias reply_t - Response callback, invoked upon the reactor thread
+    using reply_t = std::function<void (RpcStatus status, const byte* response, uint32_t length)>;
+
+  protected:
+    //! \struct State - Connection state shared with reactor callbacks
+    struct State
+    {
+      SocketReactor*                         Reactor;     //!< Reactor servicing the connection
+      HSocket                                Handle;      //!< Connected socket
+
+      std::mutex                             Mutex;       //!< Guards 'Queued', 'Pending', 'NextId', 'Scheduled' and 'Closed'
+      std::vector<byte>                      Queued;      //!< Requests awaiting the reactor thread
+      std::unordered_map<uint64_t,reply_t>   Pending;     //!< Callbacks of calls awaiting responses, by request id
+      uint64_t                               NextId;      //!< Next request id
+      bool                                   Scheduled,   //!< Whether a flush has been posted to the reactor
+                                             Closed;      //!< Whether the connection has been closed
+
+      FrameDecoder                           Decoder;     //!< Response reassembly  (Reactor thread only)
+      std::vector<byte>                      Input,       //!< Receive buffer  (Reactor thread only)
+                                             Output;      //!< Unsent requests  (Reactor thread only)
+      size_t                                 Offset;      //!< Position of first unsent byte within 'Output'
+      bool                                   Writing;     //!< Whether waiting for the socket to become writable
+      std::atomic<uint64_t>                  Batches;     //!< Number of request batches sent
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<State>  Shared;     //!< Shared state
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::RpcClient
+    //! Issue calls over a connected socket
+    //!
+    //! \param[in,out] &reactor - Reactor that services the connection
+    //! \param[in,out] &connection - Connected socket
+    //!
+    //! \throw wtl::socket_error - Unable to make socket non-blocking
+    /////////////////////////////////////////////////////////////////////////////////////////
+    RpcClient(SocketReactor& reactor, socket_t& connection) : Shared(std::make_shared<State>())
+    {
+      State& s = *Shared;
+      s.Reactor = &reactor;
+      s.Handle = connection.handle();
+      s.NextId = 1;
+      s.Scheduled = s.Closed = s.Writing = false;
+      s.Input.resize(64 * 1024);
+      s.Offset = 0;
+      s.Batches = 0;
+
+      std::shared_ptr<State> state = Shared;
+      reactor.add(connection, SocketEvent::Read, [state] (::SOCKET, SocketEvent ev) { service(*state, ev); });
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(RpcClient);      //!< Cannot be copied
+    ENABLE_MOVE(RpcClient);       //!< Can be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::~RpcClient
+    //! Closes the connection, completing calls still in flight with RpcStatus::Disconnected
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~RpcClient()
+    {
+      if (std::shared_ptr<State> state = Shared)
+        state->Reactor->post([state] { disconnect(*state); });
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::batches const
+    //! Get the number of request batches sent. The ratio of calls to batches is the mean batch size.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t batches() const
+    {
+      return Shared->Batches;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::pending const
+    //! Get the number of calls awaiting responses
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t pending() const
+    {
+      std::lock_guard<std::mutex> lock(Shared->Mutex);
+      return Shared->Pending.size();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::call
+    //! Issues a call without waiting for its response
+    //!
+    //! \param[in] method - Method
+    //! \param[in] const* request - Request body
+    //! \param[in] length - Length of request body, in bytes
+    //! \param[in] const& reply - Response callback, invoked upon the reactor thread (or the calling thread if disconnected)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void call(uint32_t method, const byte* request, uint32_t length, const reply_t& reply)
+    {
+      State& s = *Shared;
+      bool closed, schedule;
+      {
+        std::lock_guard<std::mutex> lock(s.Mutex);
+        closed = s.Closed;
+        schedule = !closed && !s.Scheduled;
+
+        if (!closed)
+        {
+          const uint64_t id = s.NextId++;
+          s.Pending.emplace(id, reply);
+          rpc_append(s.Queued, id, method, request, length);
+          s.Scheduled = true;     // Post one flush per batch
+        }
+      }
+
+      if (closed)
+        reply(RpcStatus::Disconnected, nullptr, 0);
+      else if (schedule)
+      {
+        std::shared_ptr<State> state = Shared;
+        s.Reactor->post([state] { flush(*state); });
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::call
+    //! Issues a call, returning a future of its response
+    //!
+    //! \param[in] method - Method
+    //! \param[in] const* request - Request body
+    //! \param[in] length - Length of request body, in bytes
+    //! \return std::future<std::vector<byte>> - Response body, or wtl::domain_error if the call failed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::future<std::vector<byte>> call(uint32_t method, const byte* request, uint32_t length)
+    {
+      auto promise = std::make_shared<std::promise<std::vector<byte>>>();
+
+      call(method, request, length, [promise] (RpcStatus status, const byte* response, uint32_t n) {
+        if (status == RpcStatus::Success)
+          promise->set_value(std::vector<byte>(response, response + n));
+        else
+          promise->set_exception(std::make_exception_ptr(wtl::domain_error(HERE, "Remote call failed with status ", enum_cast(status), ": ",
+                                                                            std::string(reinterpret_cast<const char*>(response), n))));
+      });
+      return promise->get_future();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::disconnect
+    //! Closes the connection and completes every pending call with RpcStatus::Disconnected
+    //!
+    //! \param[in,out] &s - Client state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void disconnect(State& s)
+    {
+      std::unordered_map<uint64_t,reply_t> pending;
+      {
+        std::lock_guard<std::mutex> lock(s.Mutex);
+        if (s.Closed)
+          return;
+        s.Closed = true;
+        std::swap(pending, s.Pending);
+      }
+
+      s.Reactor->remove(s.Handle);
+      for (auto& p : pending)
+        p.second(RpcStatus::Disconnected, nullptr, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::flush
+    //! Sends queued requests as a single batch
+    //!
+    //! \param[in,out] &s - Client state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void flush(State& s)
+    {
+      {
+        std::lock_guard<std::mutex> lock(s.Mutex);
+        s.Scheduled = false;
+        if (s.Closed)
+          return;
+
+        if (s.Output.empty())
+          std::swap(s.Output, s.Queued);
+        else
+          s.Output.insert(s.Output.end(), s.Queued.begin(), s.Queued.end());
+        s.Queued.clear();
+      }
+      ++s.Batches;
+      send(s);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::send
+    //! Sends unsent requests, waiting for writability only while output remains
+    //!
+    //! \param[in,out] &s - Client state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void send(State& s)
+    {
+      try
+      {
+        const bool drained = rpc_send(s.Handle, s.Output, s.Offset);
+        if (drained == s.Writing)
+        {
+          s.Writing = !drained;
+          s.Reactor->modify(s.Handle, drained ? SocketEvent::Read : SocketEvent::Read|SocketEvent::Write);
+        }
+      }
+      catch (socket_error&)
+      {
+        disconnect(s);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // RpcClient::service
+    //! Reads responses and completes their calls
+    //!
+    //! \param[in,out] &s - Client state
+    //! \param[in] ev - Readiness
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void service(State& s, SocketEvent ev)
+    {
+      if (enum_cast(ev & SocketEvent::Write) != 0)
+        send(s);
+
+      if (enum_cast(ev & (SocketEvent::Read|SocketEvent::Close)) != 0)
+      {
+        int n = ::recv(s.Handle, reinterpret_cast<char*>(s.Input.data()), static_cast<int>(s.Input.size()), 0);
+
+        // [CLOSED/FAILED] Fail pending calls
+        if (n == 0 || (n == SOCKET_ERROR && ::WSAGetLastError() != WSAEWOULDBLOCK))
+          return disconnect(s);
+
+        try
+        {
+          if (n > 0)
+            s.Decoder.feed(s.Input.data(), n, [&s] (const byte* payload, uint32_t length) {
+              uint64_t id, status;
+              uint32_t header = rpc_decode(payload, length, id, status);
+
+              // Claim callback of matching call
+              reply_t reply;
+              {
+                std::lock_guard<std::mutex> lock(s.Mutex);
+                auto pos = s.Pending.find(id);
+                if (pos == s.Pending.end())
+                  return;
+                reply = std::move(pos->second);
+                s.Pending.erase(pos);
+              }
+              reply(static_cast<RpcStatus>(status), payload + header, length - header);
+            });
+        }
+        catch (wtl::domain_error&)
+        {
+          // [MALFORMED] Fail pending calls
+          disconnect(s);
+        }
+      }
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_RPC_CHANNEL_HPP
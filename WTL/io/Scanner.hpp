@@ -0,0 +1,494 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\Scanner.hpp
+//! \brief Provides regex-free token rules and a lexer that dispatches upon a compile-time jump table
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SCANNER_HPP
+#define WTL_SCANNER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/traits/EnumTraits.hpp>      //!< is_attribute
+#include <wtl/io/StreamView.hpp>          //!< StreamView
+#include <cstring>                        //!< memcmp
+#include <utility>                        //!< std::index_sequence
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum CharClass - Defines character classes recognised by token rules
+  //////////////////////////////////////////////////////////////////////////////////////////
+  enum class CharClass : uint8_t
+  {
+    None = 0x00,          //!< Unclassified
+    Space = 0x01,         //!< Space, tab, vertical tab, form feed
+    Newline = 0x02,       //!< Carriage return, line feed
+    Digit = 0x04,         //!< Decimal digits
+    Alpha = 0x08,         //!< ASCII letters
+    Underscore = 0x10,    //!< Underscore
+    HexDigit = 0x20,      //!< Hexadecimal digits
+    Sign = 0x40,          //!< Plus, minus
+    Punct = 0x80,         //!< ASCII punctuation
+
+    Whitespace = Space|Newline,       //!< All whitespace
+    Word = Alpha|Digit|Underscore,    //!< Identifier characters
+  };
+
+  //! Define traits: Non-contiguous attribute
+  template <> struct is_attribute<CharClass>  : std::true_type  {};
+  template <> struct is_contiguous<CharClass> : std::false_type {};
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::classify constexpr
+  //! Classifies a single byte
+  //!
+  //! \param[in] c - Byte value
+  //! \return uint8_t - Combination of CharClass flags
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint8_t classify(uint32_t c)
+  {
+    return (c == ' ' || c == '\t' || c == '\v' || c == '\f'           ? static_cast<uint8_t>(CharClass::Space) : 0)
+         | (c == '\r' || c == '\n'                                    ? static_cast<uint8_t>(CharClass::Newline) : 0)
+         | (c >= '0' && c <= '9'                                      ? static_cast<uint8_t>(CharClass::Digit) : 0)
+         | ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')          ? static_cast<uint8_t>(CharClass::Alpha) : 0)
+         | (c == '_'                                                  ? static_cast<uint8_t>(CharClass::Underscore) : 0)
+         | ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F') ? static_cast<uint8_t>(CharClass::HexDigit) : 0)
+         | (c == '+' || c == '-'                                      ? static_cast<uint8_t>(CharClass::Sign) : 0)
+         | (((c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') || (c >= '{' && c <= '~')) ? static_cast<uint8_t>(CharClass::Punct) : 0);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ByteTable - Lookup table indexed by byte value
+  //!
+  //! \tparam T - Entry type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct ByteTable
+  {
+    T  Entries[256];    //!< Entry for each byte value
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ByteTable::operator[] constexpr
+    //! Lookup entry
+    //!
+    //! \param[in] c - Character
+    //! \return T - Entry for byte value of 'c'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    constexpr T operator[](char c) const
+    {
+      return Entries[static_cast<uint8_t>(c)];
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::generate_char_classes constexpr
+  //! Generates the classification of every byte value
+  //!
+  //! \tparam IDX... - Byte values
+  //!
+  //! \return ByteTable<uint8_t> - Classification table
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <size_t... IDX>
+  constexpr ByteTable<uint8_t> generate_char_classes(std::index_sequence<IDX...>)
+  {
+    return ByteTable<uint8_t> { { classify(IDX)... } };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct char_classes - Compile-time character classification table
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename = void>
+  struct char_classes
+  {
+    static constexpr ByteTable<uint8_t> Table = generate_char_classes(std::make_index_sequence<256>());    //!< Classification of each byte value
+  };
+
+  //! Define static table
+  template <typename T>
+  constexpr ByteTable<uint8_t> char_classes<T>::Table;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::is_class
+  //! Query whether a character belongs to any of a set of character classes
+  //!
+  //! \param[in] c - Character
+  //! \param[in] cls - Character class(es)
+  //! \return bool - True iff 'c' belongs to any class within 'cls'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr bool is_class(char c, CharClass cls)
+  {
+    return (char_classes<>::Table[c] & static_cast<uint8_t>(cls)) != 0;
+  }
+
+
+  // ---------------------------------------- RULES ----------------------------------------
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LiteralRule - Matches a fixed sequence of characters
+  //!
+  //! \tparam CHARS... - Characters
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <char FIRST, char... CHARS>
+  struct LiteralRule
+  {
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LiteralRule::first constexpr
+    //! Query whether a match can begin with a character
+    //!
+    //! \param[in] c - Byte value
+    //! \return bool - True iff 'c' is the first character of the literal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool first(uint32_t c)
+    {
+      return c == static_cast<uint8_t>(FIRST);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LiteralRule::scan
+    //! Matches the literal
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond match, or nullptr if unmatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end)
+    {
+      static constexpr char Literal[] = { FIRST, CHARS... };
+
+      // Compare as a single block
+      if (end - pos < static_cast<ptrdiff_t>(sizeof(Literal)) || memcmp(pos, Literal, sizeof(Literal)) != 0)
+        return nullptr;
+
+      return pos + sizeof(Literal);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ClassRule - Matches one or more characters of a character class
+  //!
+  //! \tparam CLASS - Character class(es)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <CharClass CLASS>
+  struct ClassRule
+  {
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ClassRule::first constexpr
+    //! Query whether a match can begin with a character
+    //!
+    //! \param[in] c - Byte value
+    //! \return bool - True iff 'c' belongs to the class
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool first(uint32_t c)
+    {
+      return (classify(c) & static_cast<uint8_t>(CLASS)) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ClassRule::scan
+    //! Matches the longest run of characters within the class
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond match, or nullptr if unmatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end)
+    {
+      const char* start = pos;
+
+      while (pos != end && is_class(*pos, CLASS))
+        ++pos;
+
+      return pos != start ? pos : nullptr;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IdentifierRule - Matches a letter or underscore followed by any letters, digits or underscores
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct IdentifierRule
+  {
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // IdentifierRule::first constexpr
+    //! Query whether a match can begin with a character
+    //!
+    //! \param[in] c - Byte value
+    //! \return bool - True iff 'c' is a letter or underscore
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool first(uint32_t c)
+    {
+      return (classify(c) & static_cast<uint8_t>(CharClass::Alpha|CharClass::Underscore)) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // IdentifierRule::scan
+    //! Matches an identifier
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond match, or nullptr if unmatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end)
+    {
+      if (pos == end || !is_class(*pos, CharClass::Alpha|CharClass::Underscore))
+        return nullptr;
+
+      // Consume remaining word characters
+      for (++pos; pos != end && is_class(*pos, CharClass::Word); ++pos)
+      {}
+      return pos;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct NumberRule - Matches a decimal number with optional sign, fraction and exponent
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct NumberRule
+  {
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NumberRule::first constexpr
+    //! Query whether a match can begin with a character
+    //!
+    //! \param[in] c - Byte value
+    //! \return bool - True iff 'c' is a digit or sign
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool first(uint32_t c)
+    {
+      return (classify(c) & static_cast<uint8_t>(CharClass::Digit|CharClass::Sign)) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NumberRule::scan
+    //! Matches [+-]?[0-9]+(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond match, or nullptr if unmatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end)
+    {
+      // Sign
+      if (pos != end && is_class(*pos, CharClass::Sign))
+        ++pos;
+
+      // Integer part
+      if (!(pos = digits(pos, end)))
+        return nullptr;
+
+      // [FRACTION] Accept only if followed by digits
+      if (pos != end && *pos == '.')
+        if (const char* fraction = digits(pos+1, end))
+          pos = fraction;
+
+      // [EXPONENT] Accept only if followed by digits
+      if (pos != end && (*pos == 'e' || *pos == 'E'))
+      {
+        const char* exponent = pos+1;
+        if (exponent != end && is_class(*exponent, CharClass::Sign))
+          ++exponent;
+
+        if ((exponent = digits(exponent, end)))
+          pos = exponent;
+      }
+
+      return pos;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NumberRule::digits
+    //! Matches one or more decimal digits
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond digits, or nullptr if none
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* digits(const char* pos, const char* end)
+    {
+      return ClassRule<CharClass::Digit>::scan(pos, end);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct QuotedRule - Matches a quoted string, including quotes. Quotes may be escaped by a
+  //! backslash or by doubling them. Escapes are not decoded.
+  //!
+  //! \tparam QUOTE - Quote character
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <char QUOTE = '"'>
+  struct QuotedRule
+  {
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // QuotedRule::first constexpr
+    //! Query whether a match can begin with a character
+    //!
+    //! \param[in] c - Byte value
+    //! \return bool - True iff 'c' is the quote character
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool first(uint32_t c)
+    {
+      return c == static_cast<uint8_t>(QUOTE);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // QuotedRule::scan
+    //! Matches a quoted string
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \return const char* - Position beyond closing quote, or nullptr if unmatched or unterminated
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end)
+    {
+      if (pos == end || *pos != QUOTE)
+        return nullptr;
+
+      // Search for closing quote
+      for (++pos; pos != end; ++pos)
+      {
+        // [ESCAPE] Skip escaped character
+        if (*pos == '\\')
+        {
+          if (++pos == end)
+            break;
+        }
+        // [QUOTE] Skip doubled quote, otherwise finish
+        else if (*pos == QUOTE)
+        {
+          if (pos+1 == end || pos[1] != QUOTE)
+            return pos+1;
+          ++pos;
+        }
+      }
+
+      // Unterminated
+      return nullptr;
+    }
+  };
+
+  //! \alias WhitespaceRule - Matches any run of whitespace
+  using WhitespaceRule = ClassRule<CharClass::Whitespace>;
+
+
+  // ---------------------------------------- LEXER ----------------------------------------
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Token - Result of lexing a single token
+  //!
+  //! \tparam CHAR - Character type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHAR>
+  struct Token
+  {
+    uint32_t          Kind;     //!< Zero-based index of matching rule
+    StreamView<CHAR>  Text;     //!< Matched text
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::candidate_mask constexpr
+  //! Base case for generating a set of rules that could match a character
+  //!
+  //! \tparam IDX - Index of next rule
+  //!
+  //! \param[in] c - Byte value
+  //! \return uint32_t - Empty set
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <uint32_t IDX>
+  constexpr uint32_t candidate_mask(uint32_t c)
+  {
+    return 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::candidate_mask constexpr
+  //! Generates the set of rules that could match a character
+  //!
+  //! \tparam IDX - Index of rule 'FIRST'
+  //! \tparam FIRST - Next rule
+  //! \tparam REST... - Subsequent rules
+  //!
+  //! \param[in] c - Byte value
+  //! \return uint32_t - Bitmask where bit N is set iff rule N could match 'c'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <uint32_t IDX, typename FIRST, typename... REST>
+  constexpr uint32_t candidate_mask(uint32_t c)
+  {
+    return (FIRST::first(c) ? 1u << IDX : 0u) | candidate_mask<IDX+1, REST...>(c);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::generate_candidates constexpr
+  //! Generates the candidate rules for every byte value
+  //!
+  //! \tparam RULES... - Token rules
+  //! \tparam IDX... - Byte values
+  //!
+  //! \return ByteTable<uint32_t> - Jump table of candidate rule bitmasks
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename... RULES, size_t... IDX>
+  constexpr ByteTable<uint32_t> generate_candidates(std::index_sequence<IDX...>)
+  {
+    return ByteTable<uint32_t> { { candidate_mask<0, RULES...>(IDX)... } };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Lexer - Matches the longest of a set of token rules, considering only the rules that
+  //! can begin with the current character. Earlier rules win ties.
+  //!
+  //! \tparam RULES... - Token rules, each providing constexpr 'first(c)' and 'scan(pos,end)'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename... RULES>
+  struct Lexer
+  {
+    static_assert(sizeof...(RULES) > 0 && sizeof...(RULES) <= 32, "Lexers support between 1 and 32 rules");
+
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var npos - Sentinel value for 'no rule matched'
+    static constexpr uint32_t npos = static_cast<uint32_t>(-1);
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lexer::scan
+    //! Matches the longest token
+    //!
+    //! \param[in] const* pos - Input position
+    //! \param[in] const* end - End of input
+    //! \param[in,out] &kind - On output the zero-based index of the matching rule, otherwise npos
+    //! \return const char* - Position beyond match, or nullptr if unmatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static const char* scan(const char* pos, const char* end, uint32_t& kind)
+    {
+      using scanner_t = const char* (*)(const char*, const char*);
+      static constexpr scanner_t Rules[] = { &RULES::scan... };
+
+      const char* longest = nullptr;
+      kind = npos;
+
+      if (pos == end)
+        return nullptr;
+
+      // Try each candidate rule
+      for (uint32_t candidates = Table[*pos], idx = 0; candidates; candidates >>= 1, ++idx)
+        if (candidates & 1)
+          if (const char* match = Rules[idx](pos, end))
+            if (!longest || match > longest)
+              longest = match, kind = idx;
+
+      return longest;
+    }
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    static constexpr ByteTable<uint32_t> Table = generate_candidates<RULES...>(std::make_index_sequence<256>());     //!< Candidate rules for each byte value
+  };
+
+  //! Define static table
+  template <typename... RULES>
+  constexpr ByteTable<uint32_t> Lexer<RULES...>::Table;
+
+} //namespace wtl
+#endif // WTL_SCANNER_HPP
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SendFile.hpp
+//! \brief Provides file-to-socket transfer without copying through user-mode buffers
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SEND_FILE_HPP
+#define WTL_SEND_FILE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/WinAPI.h>                       //!< WinAPI
+#include <wtl/io/Socket.hpp>                  //!< Socket
+#include <wtl/io/MappedFile.hpp>              //!< MappedFile
+#include <wtl/utils/Path.hpp>                 //!< Path
+#include <wtl/utils/ScopeGuard.hpp>           //!< BasicScopeGuard
+#include <mswsock.h>                          //!< TransmitFile
+#include <algorithm>                          //!< std::min
+#include <climits>                            //!< INT_MAX
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \var TransmitFileMaxLength - Largest transfer accepted by one call to TransmitFile
+  constexpr uint32_t TransmitFileMaxLength = INT_MAX - 1;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::sendFile
+  //! Sends a range of a memory-mapped file directly from the mapping
+  //!
+  //! \tparam FAMILY - Address family
+  //!
+  //! \param[in,out] &s - Connected, blocking socket
+  //! \param[in] const& file - Mapped file
+  //! \param[in] offset - Offset of range, in bytes
+  //! \param[in] length - [optional] Length of range, in bytes, which is truncated at the end of the file
+  //! \return uint64_t - Number of bytes sent
+  //!
+  //! \throw wtl::out_of_range - Offset beyond end of file
+  //! \throw wtl::socket_error - Failed to send
+  //!
+  //! \remarks The socket copies from the mapped pages directly, so file contents never pass through an
+  //! \remarks  intermediate buffer.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY>
+  uint64_t sendFile(Socket<FAMILY>& s, const MappedFile& file, uint64_t offset, uint64_t length = UINT64_MAX)
+  {
+    if (offset > file.size())
+      throw wtl::out_of_range(HERE, "Offset ", offset, " exceeds file of ", file.size(), " bytes");
+
+    length = std::min(length, file.size() - offset);
+
+    // Send in chunks of at most INT_MAX bytes, resuming after partial sends
+    const byte* pos = file.data() + offset;
+    for (uint64_t remaining = length; remaining != 0; )
+    {
+      const int32_t n = s.send(pos, static_cast<uint32_t>(std::min<uint64_t>(remaining, INT_MAX)));
+      pos += n;
+      remaining -= n;
+    }
+    return length;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::sendFile
+  //! Sends a range of a file with TransmitFile, which reads the file within the kernel
+  //!
+  //! \tparam FAMILY - Address family
+  //! \tparam ENC - Path character encoding
+  //!
+  //! \param[in,out] &s - Connected socket
+  //! \param[in] const& path - Full path of file
+  //! \param[in] offset - Offset of range, in bytes
+  //! \param[in] length - [optional] Length of range, in bytes, which is truncated at the end of the file
+  //! \return uint64_t - Number of bytes sent
+  //!
+  //! \throw wtl::platform_error - Unable to open file
+  //! \throw wtl::out_of_range - Offset beyond end of file
+  //! \throw wtl::socket_error - Failed to send
+  //!
+  //! \remarks Falls back to sending from a mapping of the file when the socket's provider doesn't implement
+  //! \remarks  TransmitFile. Ranges longer than TransmitFileMaxLength are sent with successive calls.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY, Encoding ENC>
+  uint64_t sendFile(Socket<FAMILY>& s, const Path<ENC>& path, uint64_t offset, uint64_t length = UINT64_MAX)
+  {
+    ::LPFN_TRANSMITFILE transmit = nullptr;
+    ::GUID id = WSAID_TRANSMITFILE;
+    ::DWORD bytes = 0;
+
+    // [UNSUPPORTED] Send from mapping
+    if (::WSAIoctl(s.handle(), SIO_GET_EXTENSION_FUNCTION_POINTER, &id, sizeof(id), &transmit, sizeof(transmit), &bytes, nullptr, nullptr) == SOCKET_ERROR || !transmit)
+      return sendFile(s, MappedFile(path), offset, length);
+
+    // Open file for sequential reading
+    ::HANDLE file = WinAPI<ENC>::createFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      throw platform_error(HERE, "Unable to open file");
+    BasicScopeGuard closeFile = [file] { ::CloseHandle(file); };
+
+    ::LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size))
+      throw platform_error(HERE, "Unable to query file size");
+
+    if (offset > static_cast<uint64_t>(size.QuadPart))
+      throw wtl::out_of_range(HERE, "Offset ", offset, " exceeds file of ", size.QuadPart, " bytes");
+    length = std::min(length, static_cast<uint64_t>(size.QuadPart) - offset);
+
+    // Sockets are overlapped by default, so supply the offset through an OVERLAPPED and await each transfer
+    ::HANDLE event = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+    if (!event)
+      throw platform_error(HERE, "Unable to create event");
+    BasicScopeGuard closeEvent = [event] { ::CloseHandle(event); };
+
+    uint64_t sent = 0;
+    while (sent < length)
+    {
+      const uint64_t position = offset + sent;
+      const ::DWORD chunk = static_cast<::DWORD>(std::min<uint64_t>(length - sent, TransmitFileMaxLength));
+
+      ::OVERLAPPED ov {};
+      ov.Offset = static_cast<::DWORD>(position);
+      ov.OffsetHigh = static_cast<::DWORD>(position >> 32);
+      ov.hEvent = event;
+
+      if (!transmit(s.handle(), file, chunk, 0, &ov, nullptr, 0) && ::WSAGetLastError() != WSA_IO_PENDING)
+        throw socket_error(HERE, "Unable to transmit file");
+
+      ::DWORD n = 0, flags = 0;
+      if (!::WSAGetOverlappedResult(s.handle(), &ov, &n, TRUE, &flags))
+        throw socket_error(HERE, "Unable to transmit file");
+
+      // [TRUNCATED] File shrank during transfer
+      if (!n)
+        break;
+      sent += n;
+    }
+    return sent;
+  }
+
+} // WTL namespace
+
+#endif // WTL_SEND_FILE_HPP
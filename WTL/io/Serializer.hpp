@@ -0,0 +1,633 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\Serializer.hpp
+//! \brief Generates binary and xml codecs from a field list declared once per type
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SERIALIZER_HPP
+#define WTL_SERIALIZER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/NameValuePair.hpp>    //!< NameValuePair, name_value_pairs
+#include <wtl/io/BinaryReader.hpp>        //!< BinaryReader
+#include <wtl/io/BinaryWriter.hpp>        //!< BinaryWriter
+#include <wtl/io/XmlReader.hpp>           //!< XmlReader
+#include <wtl/io/XmlWriter.hpp>           //!< XmlWriter
+#include <tuple>                          //!< std::tuple
+#include <utility>                        //!< std::index_sequence
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \def SERIAL_FIELDS - Declares the serializable fields of a type, within namespace wtl
+//!
+//! \param[in] type - Class/structure type
+//! \param[in] ... - Alternating sequence of field names and fields, accessed through the object 'obj'
+//!
+//! \remarks eg. SERIAL_FIELDS(Point32, "X", obj.X, "Y", obj.Y);
+//////////////////////////////////////////////////////////////////////////////////////////
+#define SERIAL_FIELDS(type, ...)                                                      \
+  template <>                                                                         \
+  struct serial_fields<type>                                                          \
+  {                                                                                   \
+    static const char* name()                { return #type; }                        \
+    template <typename OBJ> static auto fields(OBJ& obj)  { return name_value_pairs(__VA_ARGS__); }  \
+  }
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct serial_fields - Declares the field list of a serializable type.
+  //!
+  //! \tparam T - Class/structure type
+  //!
+  //! \remarks Specializations provide 'static const char* name()' and 'static auto fields(OBJ& obj)', returning
+  //! \remarks the name/value pairs of 'obj' in the order they are serialized. See SERIAL_FIELDS.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct serial_fields;   /* Undefined */
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct is_serializable - Queries whether a type has declared its serializable fields
+  //!
+  //! \tparam T - Input type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename = void>
+  struct is_serializable : std::false_type
+  {};
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct is_serializable - Specialization for types with a field list
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct is_serializable<T, decltype(serial_fields<T>::fields(std::declval<T&>()), void())> : std::true_type
+  {};
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \alias enable_if_serializable_t - Defines an SFINAE expression requiring a type with a field list
+  //!
+  //! \tparam T - Input type
+  //! \tparam RET - [optional] Desired type if expression is valid   (Default is void)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename RET = void>
+  using enable_if_serializable_t = std::enable_if_t<is_serializable<T>::value, RET>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct is_bulk_field - Queries whether a field is encoded in binary as its object representation, and
+  //! can therefore be copied together with adjacent fields of the same kind
+  //!
+  //! \tparam T - Field type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct is_bulk_field : std::integral_constant<bool, (std::is_arithmetic<T>::value || std::is_enum<T>::value)
+                                                    && !std::is_same<std::remove_cv_t<T>,bool>::value>
+  {};
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct has_child_fields - Queries whether a field list contains nested serializable types
+  //!
+  //! \tparam TUPLE - Name/value pair tuple type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename TUPLE>
+  struct has_child_fields;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct has_child_fields - Base case
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  struct has_child_fields<std::tuple<>> : std::false_type
+  {};
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct has_child_fields - Recursive case
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename VALUE, typename... FIELDS>
+  struct has_child_fields<std::tuple<NameValuePair<VALUE>, FIELDS...>>
+    : std::integral_constant<bool, is_serializable<VALUE>::value || has_child_fields<std::tuple<FIELDS...>>::value>
+  {};
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::for_each_field
+  //! Applies a function object to each name/value pair of a field list, in order
+  //!
+  //! \tparam TUPLE - Name/value pair tuple type
+  //! \tparam FUNC - Function object type
+  //! \tparam IDX... - Field indicies
+  //!
+  //! \param[in] const& fields - Name/value pairs
+  //! \param[in,out] &fn - Function object
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename TUPLE, typename FUNC, size_t... IDX>
+  void for_each_field(const TUPLE& fields, FUNC& fn, std::index_sequence<IDX...>)
+  {
+    using expand = int[];
+
+    // Expand in declaration order
+    (void)expand { 0, (fn(std::get<IDX>(fields)), 0)... };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::for_each_field
+  //! Applies a function object to each name/value pair of a field list, in order
+  //!
+  //! \tparam TUPLE - Name/value pair tuple type
+  //! \tparam FUNC - Function object type
+  //!
+  //! \param[in] const& fields - Name/value pairs
+  //! \param[in,out] &fn - Function object
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename TUPLE, typename FUNC>
+  void for_each_field(const TUPLE& fields, FUNC& fn)
+  {
+    for_each_field(fields, fn, std::make_index_sequence<std::tuple_size<TUPLE>::value>());
+  }
+
+
+  // ---------------------------------------- BINARY ----------------------------------------
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct binary_field_writer - Writes fields in binary, coalescing adjacent bulk fields into a single copy
+  //!
+  //! \tparam STREAM - Stream type
+  //!
+  //! \remarks Field addresses are compile-time offsets from the object, so once inlined the adjacency tests fold away
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct binary_field_writer
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    BinaryWriter<STREAM>&  Writer;      //!< Output
+    const byte*            First;       //!< First byte of pending run
+    uint32_t               Length;      //!< Length of pending run, in bytes
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_writer::binary_field_writer
+    //! Create writer with no pending run
+    //!
+    //! \param[in,out] &w - Binary writer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    binary_field_writer(BinaryWriter<STREAM>& w) : Writer(w), First(nullptr), Length(0)
+    {}
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_writer::operator()
+    //! Appends a bulk field to the pending run, flushing the run if the field is not adjacent
+    //!
+    //! \param[in] const& f - Field
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename VALUE>
+    std::enable_if_t<is_bulk_field<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      const byte* addr = reinterpret_cast<const byte*>(&f.Value);
+
+      // [NOT ADJACENT] Start new run
+      if (addr != First + Length)
+      {
+        flush();
+        First = addr;
+      }
+      Length += sizeof(VALUE);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_writer::operator()
+    //! Flushes the pending run then writes a field individually
+    //!
+    //! \param[in] const& f - Field
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename VALUE>
+    std::enable_if_t<!is_bulk_field<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      flush();
+      Writer << f.Value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_writer::flush
+    //! Writes the pending run, if any
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      if (Length)
+        Writer.write(First, Length);
+      Length = 0;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct binary_field_reader - Reads fields in binary, coalescing adjacent bulk fields into a single copy
+  //!
+  //! \tparam STREAM - Stream type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct binary_field_reader
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    BinaryReader<STREAM>&  Reader;      //!< Input
+    byte*                  First;       //!< First byte of pending run
+    uint32_t               Length;      //!< Length of pending run, in bytes
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_reader::binary_field_reader
+    //! Create reader with no pending run
+    //!
+    //! \param[in,out] &r - Binary reader
+    /////////////////////////////////////////////////////////////////////////////////////////
+    binary_field_reader(BinaryReader<STREAM>& r) : Reader(r), First(nullptr), Length(0)
+    {}
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_reader::operator()
+    //! Appends a bulk field to the pending run, flushing the run if the field is not adjacent
+    //!
+    //! \param[in] const& f - Field  (Refers to a mutable object)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename VALUE>
+    std::enable_if_t<is_bulk_field<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      byte* addr = reinterpret_cast<byte*>(&const_cast<VALUE&>(f.Value));
+
+      // [NOT ADJACENT] Start new run
+      if (addr != First + Length)
+      {
+        flush();
+        First = addr;
+      }
+      Length += sizeof(VALUE);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_reader::operator()
+    //! Flushes the pending run then reads a field individually
+    //!
+    //! \param[in] const& f - Field  (Refers to a mutable object)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename VALUE>
+    std::enable_if_t<!is_bulk_field<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      flush();
+      Reader >> const_cast<VALUE&>(f.Value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // binary_field_reader::flush
+    //! Reads the pending run, if any
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      if (Length)
+        Reader.read(First, Length);
+      Length = 0;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator <<
+  //! Writes the declared fields of an object to a stream in binary
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &w - Binary writer
+  //! \param[in] const& obj - Object
+  //! \return BinaryWriter<STREAM>& - Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  enable_if_serializable_t<T,BinaryWriter<STREAM>&> operator << (BinaryWriter<STREAM>& w, const T& obj)
+  {
+    binary_field_writer<STREAM> writer(w);
+
+    // Write fields, then any trailing run
+    for_each_field(serial_fields<T>::fields(obj), writer);
+    writer.flush();
+    return w;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Reads the declared fields of an object from a stream in binary
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &r - Binary reader
+  //! \param[in,out] &obj - Object
+  //! \return BinaryReader<STREAM>& - Reference to 'r'
+  //!
+  //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  enable_if_serializable_t<T,BinaryReader<STREAM>&> operator >> (BinaryReader<STREAM>& r, T& obj)
+  {
+    binary_field_reader<STREAM> reader(r);
+
+    // Read fields, then any trailing run
+    for_each_field(serial_fields<T>::fields(obj), reader);
+    reader.flush();
+    return r;
+  }
+
+
+  // ----------------------------------------- XML ------------------------------------------
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::write_xml_element
+  //! Writes an object as an xml element named by its serial field list
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &w - Xml writer
+  //! \param[in] const* name - Element name
+  //! \param[in] const& obj - Object
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  void write_xml_element(XmlWriter<STREAM>& w, const char* name, const T& obj);
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct xml_attribute_writer - Writes non-serializable fields as xml attributes
+  //!
+  //! \tparam STREAM - Stream type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct xml_attribute_writer
+  {
+    XmlWriter<STREAM>&  Writer;      //!< Output
+
+    template <typename VALUE>
+    std::enable_if_t<!is_serializable<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      Writer << f;
+    }
+
+    template <typename VALUE>
+    enable_if_serializable_t<VALUE> operator()(const NameValuePair<VALUE>& f)
+    { /*no-op*/ }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct xml_child_writer - Writes serializable fields as xml child elements
+  //!
+  //! \tparam STREAM - Stream type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct xml_child_writer
+  {
+    XmlWriter<STREAM>&  Writer;      //!< Output
+
+    template <typename VALUE>
+    std::enable_if_t<!is_serializable<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    { /*no-op*/ }
+
+    template <typename VALUE>
+    enable_if_serializable_t<VALUE> operator()(const NameValuePair<VALUE>& f)
+    {
+      write_xml_element(Writer, f.Name, f.Value);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::write_xml_element
+  //! Writes an object as an xml element: scalar fields become attributes and nested serializable fields become child elements
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &w - Xml writer
+  //! \param[in] const* name - Element name
+  //! \param[in] const& obj - Object
+  //!
+  //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  void write_xml_element(XmlWriter<STREAM>& w, const char* name, const T& obj)
+  {
+    auto fields = serial_fields<T>::fields(obj);
+    xml_attribute_writer<STREAM> attributes { w };
+
+    // Open tag + attributes
+    w << "<" << name;
+    for_each_field(fields, attributes);
+
+    // [CHILDREN] Write children then close tag
+    if (has_child_fields<decltype(fields)>::value)
+    {
+      xml_child_writer<STREAM> children { w };
+
+      w << ">";
+      for_each_field(fields, children);
+      w << "</" << name << ">";
+    }
+    // [NO CHILDREN] Write orphan
+    else
+      w << "/>";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator <<
+  //! Writes the declared fields of an object to a stream as an xml element
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &w - Xml writer
+  //! \param[in] const& obj - Object
+  //! \return XmlWriter<STREAM>& - Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  enable_if_serializable_t<T,XmlWriter<STREAM>&> operator << (XmlWriter<STREAM>& w, const T& obj)
+  {
+    write_xml_element(w, serial_fields<T>::name(), obj);
+    return w;
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Parses a boolean xml attribute
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline void read_xml_value(const pugi::xml_attribute& attr, bool& value)
+  {
+    value = attr.as_bool();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Parses a signed integer xml attribute
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value> read_xml_value(const pugi::xml_attribute& attr, T& value)
+  {
+    value = static_cast<T>(attr.as_llong());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Parses an unsigned integer xml attribute
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T,bool>::value> read_xml_value(const pugi::xml_attribute& attr, T& value)
+  {
+    value = static_cast<T>(attr.as_ullong());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Parses a floating point xml attribute
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  enable_if_floating_t<T> read_xml_value(const pugi::xml_attribute& attr, T& value)
+  {
+    value = static_cast<T>(attr.as_double());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Parses an enumeration xml attribute from the numeral of its underlying type
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  enable_if_enum_t<T> read_xml_value(const pugi::xml_attribute& attr, T& value)
+  {
+    std::underlying_type_t<T> numeral;
+
+    read_xml_value(attr, numeral);
+    value = static_cast<T>(numeral);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_value
+  //! Copies a string xml attribute into a character array
+  //!
+  //! \param[in] const& attr - Attribute
+  //! \param[in,out] &value - Output value
+  //!
+  //! \throw wtl::length_error - [Debug only] Char array buffer overflow
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENCODING, unsigned LENGTH>
+  void read_xml_value(const pugi::xml_attribute& attr, CharArray<ENCODING,LENGTH>& value)
+  {
+    value.assign(attr.value());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_element
+  //! Reads an object from an xml element
+  //!
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in] const& node - Xml element
+  //! \param[in,out] &obj - Object
+  //! \return bool - True iff all fields were present. Missing fields are not modified.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  bool read_xml_element(const pugi::xml_node& node, T& obj);
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct xml_field_reader - Reads fields from xml attributes and child elements
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct xml_field_reader
+  {
+    const pugi::xml_node&  Node;        //!< Input
+    bool                   Complete;    //!< Whether all fields have been present
+
+    template <typename VALUE>
+    std::enable_if_t<!is_serializable<VALUE>::value> operator()(const NameValuePair<VALUE>& f)
+    {
+      // [PRESENT] Parse attribute
+      if (pugi::xml_attribute attr = Node.attribute(f.Name))
+        read_xml_value(attr, const_cast<VALUE&>(f.Value));
+      else
+        Complete = false;
+    }
+
+    template <typename VALUE>
+    enable_if_serializable_t<VALUE> operator()(const NameValuePair<VALUE>& f)
+    {
+      // Read child element
+      Complete &= read_xml_element(Node.child(f.Name), const_cast<VALUE&>(f.Value));
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::read_xml_element
+  //! Reads an object from an xml element: attributes populate scalar fields and child elements populate
+  //! nested serializable fields
+  //!
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in] const& node - Xml element
+  //! \param[in,out] &obj - Object
+  //! \return bool - True iff all fields were present. Missing fields are not modified.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  bool read_xml_element(const pugi::xml_node& node, T& obj)
+  {
+    xml_field_reader reader { node, true };
+
+    // [MISSING] Nothing to read
+    if (!node)
+      return false;
+
+    for_each_field(serial_fields<T>::fields(obj), reader);
+    return reader.Complete;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Reads the declared fields of an object from the first top-level xml element named by its field list
+  //!
+  //! \tparam STREAM - Stream type
+  //! \tparam T - Serializable type
+  //!
+  //! \param[in,out] &r - Xml reader
+  //! \param[in,out] &obj - Object
+  //! \return XmlReader<STREAM>& - Reference to 'r'
+  //!
+  //! \throw wtl::domain_error - Element or field missing
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM, typename T>
+  enable_if_serializable_t<T,XmlReader<STREAM>&> operator >> (XmlReader<STREAM>& r, T& obj)
+  {
+    if (!read_xml_element(r.root().child(serial_fields<T>::name()), obj))
+      throw wtl::domain_error(HERE, "Xml element '", serial_fields<T>::name(), "' is missing or incomplete");
+
+    return r;
+  }
+
+} //namespace wtl
+#endif // WTL_SERIALIZER_HPP
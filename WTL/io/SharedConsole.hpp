@@ -0,0 +1,204 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SharedConsole.hpp
+//! \brief Provides a debug-console that may be written concurrently from multiple threads
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SHARED_CONSOLE_HPP
+#define WTL_SHARED_CONSOLE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Console.hpp>           //!< console_stream
+#include <wtl/io/AsyncLogQueue.hpp>     //!< AsyncLogQueue
+#include <memory>                       //!< std::shared_ptr
+#include <unordered_map>                //!< std::unordered_map
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \namespace wtl - Windows template library
+//////////////////////////////////////////////////////////////////////////////////////////
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct shared_console - Debug-console sink shared by multiple threads
+  //!
+  //! \remarks Each thread writes to its own console_stream, which formats text and colour changes into a
+  //! \remarks  thread-local buffer. Flushing that stream (eg. wtl::endl) commits its contents to a lock-free
+  //! \remarks  queue as a single record, and a single thread drains the queue to the console with one write
+  //! \remarks  per batch of records. Records never interleave and the lines of each thread remain in order.
+  //!
+  //! \remarks The textcol, backcol and format manipulators work unchanged because each record begins with
+  //! \remarks  the colours of its thread.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct shared_console
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = shared_console;
+
+    //! \alias stream_t - Per-thread stream type
+    using stream_t = console_stream<char>;
+
+    //! \alias ostream_t - Output stream type of manipulators
+    using ostream_t = stream_t::base;
+
+  private:
+    //! \struct State - Output shared by all threads, owned jointly with the thread-local streams' devices
+    struct State
+    {
+      console_streambuf<char>  Output;       //!< Console output  (only accessed by the flush thread)
+      AsyncLogQueue            Queue;        //!< Committed records
+
+      State(ConsoleOutput output, uint32_t capacity, OverflowPolicy policy)
+        : Output(4096, ConsoleBackend::VirtualTerminal, output),
+          Queue([this] (uint32_t, const char* text, uint32_t length) { Output.sputn(text, length); },
+                [this] ()                                            { Output.pubsync(); },
+                capacity,
+                policy)
+      {}
+    };
+
+    //! \struct Thread - Stream of a single thread
+    struct Thread
+    {
+      std::weak_ptr<State>       Owner;      //!< Sink receiving the stream's records
+      std::unique_ptr<stream_t>  Stream;     //!< Stream
+    };
+
+    //! \alias thread_map_t - Streams of the calling thread, by sink
+    using thread_map_t = std::unordered_map<const State*, Thread>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    std::shared_ptr<State>  Shared;         //!< Shared output
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::shared_console
+    //! Create the output queue and start the thread that drains it
+    //!
+    //! \param[in] output - [optional] Standard device to write  (Default is stdout)
+    //! \param[in] capacity - [optional] Capacity of each queue buffer, in bytes  (Default is 1MB)
+    //! \param[in] policy - [optional] Behaviour of writers when the queue is full  (Default is to block)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    shared_console(ConsoleOutput output = ConsoleOutput::StdOut, uint32_t capacity = 1024*1024, OverflowPolicy policy = OverflowPolicy::Block)
+      : Shared(std::make_shared<State>(output, capacity, policy))
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(shared_console);      //!< Cannot be copied
+    ENABLE_MOVE(shared_console);       //!< Can be moved
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::~shared_console
+    //! Writes committed records then stops the flush thread. Records committed afterwards by streams
+    //! of threads that are still running are discarded.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    ~shared_console()
+    {
+      if (Shared)
+        Shared->Queue.close();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::threads
+    //! Get the streams of the calling thread
+    //!
+    //! \return thread_map_t& - Streams, which are flushed upon thread exit
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static thread_map_t& threads()
+    {
+      static thread_local thread_map_t streams;
+      return streams;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::statistics const
+    //! Get a snapshot of the latency and throughput statistics of the output queue
+    //!
+    //! \return LogStatistics - Statistics
+    //////////////////////////////////////////////////////////////////////////////////////////
+    LogStatistics statistics() const
+    {
+      return Shared->Queue.statistics();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::flush
+    //! Commits the calling thread's output then waits until all committed records have been written
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      stream().flush();
+      Shared->Queue.flush();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::stream
+    //! Get the stream of the calling thread, creating it upon first use
+    //!
+    //! \return stream_t& - Stream that commits its contents to this sink whenever it is flushed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    stream_t& stream()
+    {
+      Thread& t = threads()[Shared.get()];
+
+      // [NEW/EXPIRED] Create stream for this sink  (An expired entry belonged to a destroyed sink at the same address)
+      if (!t.Stream || t.Owner.expired())
+      {
+        std::weak_ptr<State> owner = Shared;
+
+        // Commit whole buffer as one record; dropped if the sink has been destroyed
+        auto device = [owner] (const char* text, uint32_t length)
+        {
+          if (auto state = owner.lock())
+            state->Queue.write(0, text, length);
+          return true;
+        };
+
+        t.Stream.reset(new stream_t(device));
+        t.Owner = owner;
+      }
+      return *t.Stream;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::operator<<
+    //! Writes a value to the stream of the calling thread
+    //!
+    //! \tparam T - Value type
+    //!
+    //! \param[in] const& value - Value or manipulator
+    //! \return stream_t& - Stream of the calling thread
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    stream_t& operator<<(const T& value)
+    {
+      return static_cast<stream_t&>(stream() << value);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // shared_console::operator<<
+    //! Applies a stream manipulator (eg. wtl::endl) to the stream of the calling thread
+    //!
+    //! \param[in] manip - Manipulator
+    //! \return stream_t& - Stream of the calling thread
+    //////////////////////////////////////////////////////////////////////////////////////////
+    stream_t& operator<<(ostream_t& (*manip)(ostream_t&))
+    {
+      return static_cast<stream_t&>(manip(stream()));
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_SHARED_CONSOLE_HPP
@@ -18,6 +18,52 @@
 //! \namespace wtl - Windows template library
 namespace wtl
 {
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketBuffer - Describes one buffer of a scatter/gather operation
+  //!
+  //! \remarks Binary compatible with WSABUF so that arrays may be passed directly to WSASend/WSARecv
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct SocketBuffer : ::WSABUF
+  {
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBuffer::SocketBuffer
+    //! Create empty buffer
+    //////////////////////////////////////////////////////////////////////////////////////////
+    SocketBuffer()
+    {
+      this->buf = nullptr;
+      this->len = 0;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBuffer::SocketBuffer
+    //! Create from a buffer of elements
+    //!
+    //! \tparam ELEM - Element type
+    //!
+    //! \param[in] const* buf - Buffer  (Only written by receive operations)
+    //! \param[in] len - Length of buffer (in elements rather than bytes)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEM>
+    SocketBuffer(const ELEM* buf, uint32_t len)
+    {
+      this->buf = reinterpret_cast<char*>(const_cast<ELEM*>(buf));
+      this->len = len * sizeof(ELEM);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBuffer::SocketBuffer
+    //! Create from a statically allocated array
+    //!
+    //! \tparam ELEM - Element type
+    //! \tparam LENGTH - Number of elements
+    //!
+    //! \param[in] const (&)[] arr - Statically allocated array
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEM, unsigned LENGTH>
+    SocketBuffer(const ELEM (&arr)[LENGTH]) : SocketBuffer(arr, LENGTH)
+    {}
+  };
 
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \struct Socket - Encapsulates a windows socket
@@ -42,6 +88,14 @@ namespace wtl
     //! \alias family - Define address family
 	  static constexpr AddressFamily family = FAMILY;
 
+    //! \struct Datagram - Describes one message of a batched datagram operation
+    struct Datagram
+    {
+      address_t     Address;    //!< [Send] Destination address  [Receive] Source address
+      SocketBuffer  Data;       //!< Message buffer
+      uint32_t      Length;     //!< [Receive] Number of bytes received
+    };
+
     // ----------------------------------- REPRESENTATION -----------------------------------
   private:
 	  HSocket  Handle;	      //!< Socket handle
@@ -62,10 +116,42 @@ namespace wtl
 	  {
 	  }
 
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::Socket
+    //! Create from an existing socket handle, such as one returned by 'accept'
+    //! 
+    //! \param[in] const& h - Shared socket handle
+    //! \param[in] async - [optional] Whether socket is non-blocking
+    //////////////////////////////////////////////////////////////////////////////////////////
+	  explicit
+	  Socket(const HSocket& h, bool async = false) : Handle(h), Async(async)
+	  {
+	  }
+
     // ----------------------------------- STATIC METHODS -----------------------------------
   
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::address const
+    //! Get the local address, such as the ephemeral port chosen by 'bind'
+    //! 
+    //! \return address_t - Local address
+    //! 
+    //! \throw wtl::socket_error - Unable to query address
+    /////////////////////////////////////////////////////////////////////////////////////////
+    address_t address() const
+    {
+      address_t addr {};
+      int32_t   length = sizeof(address_t);
+
+      // Query local address
+      if (::getsockname(Handle, reinterpret_cast<SOCKADDR*>(&addr), &length) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to query socket address");
+
+      return addr;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Socket::handle const
     //! Get the shared socket handle 
@@ -91,6 +177,31 @@ namespace wtl
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::accept
+    //! Accept a pending connection upon a listening socket
+    //!
+    //! \return Socket - Connected socket, sharing the non-blocking behaviour of the listening socket. When a 
+    //!                  non-blocking socket has no pending connection the handle of the result is empty.
+    //! 
+    //! \throw wtl::socket_error - Unable to accept connection
+    //////////////////////////////////////////////////////////////////////////////////////////
+    Socket accept()
+    {
+      ::SOCKET s = ::accept(Handle, nullptr, nullptr);
+
+      // [WOULD-BLOCK] Return empty handle
+      if (s == INVALID_SOCKET)
+      {
+        if (succeeded(SOCKET_ERROR))
+          return Socket(HSocket(), Async);
+
+        throw socket_error(HERE, "Unable to accept connection");
+      }
+
+      return Socket(HSocket(s, AllocType::Create), Async);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // Socket::async
     //! Request asychronous socket behaviour and message-based notifications
@@ -111,6 +222,62 @@ namespace wtl
       Async = true;
     }
     
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::blocking
+    //! Restore blocking socket behaviour
+    //!
+    //! \throw wtl::socket_error - Unable to set blocking socket behaviour
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void blocking()
+    {
+      ::u_long enable = 0;
+
+      // Set socket options
+      if (::ioctlsocket(Handle, FIONBIO, &enable) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to set blocking socket behaviour");
+
+      // Mark socket as synchronous
+      Async = false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::nonblocking
+    //! Request non-blocking socket behaviour without message-based notifications, for use with SocketReactor
+    //!
+    //! \throw wtl::socket_error - Unable to set non-blocking socket behaviour
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void nonblocking()
+    {
+      ::u_long enable = 1;
+
+      // Set socket options
+      if (::ioctlsocket(Handle, FIONBIO, &enable) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to set non-blocking socket behaviour");
+
+      // Mark socket as asychronous
+      Async = true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::bind
+    //! Bind to a local address
+    //!
+    //! \param[in] const& host - Local IP Address  (eg. "0.0.0.0" for all interfaces)
+    //! \param[in] port - Local port (in host byte order), or zero for an ephemeral port
+    //! 
+    //! \throw wtl::socket_error - Failed to bind
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void bind(const String<Encoding::ANSI>& host, uint16_t port)
+    {
+      // Encode local address
+      address_t addr { enum_cast(family), ::htons(port) };
+      addr.sin_addr.s_addr = ::inet_addr(host.c_str());
+
+      // Bind to address
+      if (::bind(Handle, reinterpret_cast<SOCKADDR*>(&addr), sizeof(address_t)) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to bind to address: " + host);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // Socket::close
     //! Closes the socket
@@ -137,16 +304,37 @@ namespace wtl
       addr.sin_addr.s_addr = ::inet_addr(host.c_str());
 
       // Connect to host
-      int32_t res = ::connect(Handle, reinterpret_cast<SOCKADDR*>(&addr), sizeof(address_t));
-      
-      // Check for synchronous/asychronous success states
-      if (res == ERROR_SUCCESS || (Async && res == SOCKET_ERROR && ::WSAGetLastError() == WSAEWOULDBLOCK))
-        return;
+      if (!connect(addr))
+        throw socket_error(HERE, "Unable to connect to host: " + host);
+    }
 
-      // Failed to connect
-      throw socket_error(HERE, "Unable to connect to host: " + host);
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::connect
+    //! Connect to an address, such as one produced by a Resolver
+    //!
+    //! \param[in] const& addr - Host address
+    //! \return bool - True if connected, or if a non-blocking socket began connecting; otherwise false and 
+    //!                the error is available from ::WSAGetLastError()
+    //////////////////////////////////////////////////////////////////////////////////////////
+    bool connect(const address_t& addr)
+    {
+      return succeeded(::connect(Handle, reinterpret_cast<const SOCKADDR*>(&addr), sizeof(address_t)));
     }
     
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::listen
+    //! Listen for incoming connections upon a bound socket
+    //!
+    //! \param[in] backlog - [optional] Maximum length of the queue of pending connections
+    //! 
+    //! \throw wtl::socket_error - Failed to listen
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void listen(int32_t backlog = SOMAXCONN)
+    {
+      if (::listen(Handle, backlog) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to listen for connections");
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // Socket::receive
     //! Receive data from a connected socket
@@ -169,7 +357,95 @@ namespace wtl
 
       return n;
     }
-    
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::receive
+    //! Receive data from a connected socket into multiple buffers with a single call, filling each in turn
+    //!
+    //! \param[in] *bufs - Buffers
+    //! \param[in] count - Number of buffers
+    //! \param[in] flags - [optional] Flags
+    //! \return int32_t - Number of bytes received  (Zero if the connection has been closed)
+    //!
+    //! \throw wtl::socket_error - Failed to receive data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    int32_t receive(SocketBuffer* bufs, uint32_t count, int32_t flags = 0)
+    {
+      ::DWORD n = 0,
+              f = static_cast<::DWORD>(flags);
+
+      // Scatter data into buffers
+      if (::WSARecv(handle(), bufs, count, &n, &f, nullptr, nullptr) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to receieve data");
+
+      return static_cast<int32_t>(n);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::receive
+    //! Receive data from a connected socket into multiple buffers with a single call, filling each in turn
+    //!
+    //! \tparam BUFFERS - SocketBuffer types
+    //!
+    //! \param[in] const& first - First buffer
+    //! \param[in] const& second - Second buffer
+    //! \param[in] const&... rest - [optional] Remaining buffers
+    //! \return int32_t - Number of bytes received  (Zero if the connection has been closed)
+    //!
+    //! \throw wtl::socket_error - Failed to receive data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... BUFFERS>
+    int32_t receive(const SocketBuffer& first, const SocketBuffer& second, const BUFFERS&... rest)
+    {
+      SocketBuffer bufs[] = { first, second, rest... };
+      return receive(bufs, 2 + sizeof...(BUFFERS));
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::receiveBatch
+    //! Receive multiple datagrams, waiting only for the first
+    //!
+    //! \param[in,out] *msgs - Messages receiving source address and length of each datagram
+    //! \param[in] count - Maximum number of messages
+    //! \param[in] flags - [optional] Flags
+    //! \return uint32_t - Number of messages received  (Zero if none were pending on an asychronous socket)
+    //!
+    //! \throw wtl::socket_error - Failed to receive the first datagram
+    //!
+    //! \remarks Winsock has no equivalent of recvmmsg, so each datagram costs one call, but callers drain the
+    //! \remarks  socket without returning to their event loop in between. Subsequent datagrams are received only
+    //! \remarks  while the socket reports pending input, so the call never waits after the first.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t receiveBatch(Datagram* msgs, uint32_t count, int32_t flags = 0)
+    {
+      uint32_t idx = 0;
+
+      for (::u_long pending = 1; idx < count && pending; ++idx)
+      {
+        Datagram& m = msgs[idx];
+        ::DWORD n = 0,
+                f = static_cast<::DWORD>(flags);
+        ::INT   addrLength = sizeof(address_t);
+
+        // Receive datagram and its source
+        if (::WSARecvFrom(handle(), &m.Data, 1, &n, &f, reinterpret_cast<SOCKADDR*>(&m.Address), &addrLength, nullptr, nullptr) == SOCKET_ERROR)
+        {
+          // [WOULD-BLOCK/FAILED] Return messages received so far; first failure is reported
+          if (idx != 0 || succeeded(SOCKET_ERROR))
+            break;
+
+          throw socket_error(HERE, "Unable to receieve datagram");
+        }
+        m.Length = n;
+
+        // Continue only while more input is pending
+        if (::ioctlsocket(handle(), FIONREAD, &pending) == SOCKET_ERROR)
+          pending = 0;
+      }
+
+      return idx;
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
     // Socket::send
     //! Send data across a connected socket
@@ -192,7 +468,87 @@ namespace wtl
 
       return n;
     }
-    
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::send
+    //! Send multiple buffers across a connected socket with a single call, without copying them together
+    //!
+    //! \param[in] const* bufs - Buffers
+    //! \param[in] count - Number of buffers
+    //! \param[in] flags - [optional] Flags
+    //! \return int32_t - Number of bytes sent
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    int32_t send(const SocketBuffer* bufs, uint32_t count, int32_t flags = 0)
+    {
+      ::DWORD n = 0;
+
+      // Gather data from buffers
+      if (::WSASend(handle(), const_cast<SocketBuffer*>(bufs), count, &n, static_cast<::DWORD>(flags), nullptr, nullptr) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to send data");
+
+      return static_cast<int32_t>(n);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::send
+    //! Send multiple buffers across a connected socket with a single call (eg. a message header and its body)
+    //!
+    //! \tparam BUFFERS - SocketBuffer types
+    //!
+    //! \param[in] const& first - First buffer
+    //! \param[in] const& second - Second buffer
+    //! \param[in] const&... rest - [optional] Remaining buffers
+    //! \return int32_t - Number of bytes sent
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... BUFFERS>
+    int32_t send(const SocketBuffer& first, const SocketBuffer& second, const BUFFERS&... rest)
+    {
+      const SocketBuffer bufs[] = { first, second, rest... };
+      return send(bufs, 2 + sizeof...(BUFFERS));
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::sendBatch
+    //! Send multiple datagrams, each to its own destination
+    //!
+    //! \param[in] const* msgs - Messages
+    //! \param[in] count - Number of messages
+    //! \param[in] flags - [optional] Flags
+    //! \return uint32_t - Number of messages sent  (Fewer than 'count' if an asychronous socket would block)
+    //!
+    //! \throw wtl::socket_error - Failed to send the first datagram
+    //!
+    //! \remarks Winsock has no equivalent of sendmmsg, so each datagram costs one call. A failure after the first
+    //! \remarks  datagram ends the batch early and is reported by the next call.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t sendBatch(const Datagram* msgs, uint32_t count, int32_t flags = 0)
+    {
+      uint32_t idx = 0;
+
+      for (; idx < count; ++idx)
+      {
+        const Datagram& m = msgs[idx];
+        ::DWORD n = 0;
+
+        // Send datagram to its destination
+        if (::WSASendTo(handle(), const_cast<SocketBuffer*>(&m.Data), 1, &n, static_cast<::DWORD>(flags),
+                        reinterpret_cast<const SOCKADDR*>(&m.Address), sizeof(address_t), nullptr, nullptr) == SOCKET_ERROR)
+        {
+          // [WOULD-BLOCK/FAILED] Return messages sent so far; first failure is reported
+          if (idx != 0 || succeeded(SOCKET_ERROR))
+            break;
+
+          throw socket_error(HERE, "Unable to send datagram");
+        }
+      }
+
+      return idx;
+    }
+
   };
 
 }
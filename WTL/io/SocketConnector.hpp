@@ -0,0 +1,238 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SocketConnector.hpp
+//! \brief Provides connection establishment with deadlines across multiple candidate addresses
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOCKET_CONNECTOR_HPP
+#define WTL_SOCKET_CONNECTOR_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Socket.hpp>                  //!< Socket
+#include <wtl/io/Resolver.hpp>                //!< Resolver
+#include <wtl/utils/String.hpp>               //!< String
+#include <algorithm>                          //!< std::min, std::max
+#include <chrono>                             //!< std::chrono
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketConnector - Connects stream sockets to named hosts within a deadline
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Candidate addresses are attempted in resolver order, in the manner of 'happy eyeballs' (RFC 8305):
+  //! \remarks  each attempt is given a head start before the next begins, without abandoning those in progress,
+  //! \remarks  and a failed attempt starts the next immediately. The first attempt to complete wins; the others
+  //! \remarks  are closed. A host with one reachable and several dead addresses therefore connects in roughly one
+  //! \remarks  round trip plus one head start per dead address ahead of it, instead of one timeout per dead address.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct SocketConnector
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketConnector<FAMILY>;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+    //! \alias address_t - Socket address type
+    using address_t = typename socket_t::address_t;
+
+    //! \alias clock_t - Timing clock
+    using clock_t = std::chrono::steady_clock;
+
+    //! \alias resolver_t - Resolver type
+    using resolver_t = Resolver<FAMILY>;
+
+    //! \struct Timing - Describes the establishment of a connection
+    struct Timing
+    {
+      clock_t::duration  Resolution;    //!< Time spent resolving the host
+      clock_t::duration  Connection;    //!< Time from the first attempt until the connection was established
+      uint32_t           Candidates;    //!< Number of addresses resolved
+      uint32_t           Attempts;      //!< Number of attempts started
+      address_t          Address;       //!< Address connected to
+    };
+
+  protected:
+    //! \struct Attempt - Connection attempt in progress
+    struct Attempt
+    {
+      socket_t   Socket;        //!< Connecting socket
+      address_t  Address;       //!< Destination
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    resolver_t&        Names;         //!< Host name resolver
+    clock_t::duration  HeadStart;     //!< Delay before starting the next attempt while others are in progress
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketConnector::SocketConnector
+    //! Create connector
+    //!
+    //! \param[in,out] &resolver - Resolver, which must outlive the connector
+    //! \param[in] headStart - [optional] Delay before starting the next attempt  (RFC 8305 recommends 250ms)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    SocketConnector(resolver_t& resolver, clock_t::duration headStart = std::chrono::milliseconds(250))
+      : Names(resolver), HeadStart(headStart)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(SocketConnector);      //!< Can be copied
+    ENABLE_MOVE(SocketConnector);      //!< Can be moved
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketConnector::connect
+    //! Connect to a host within a deadline
+    //!
+    //! \param[in] const& host - Host name or numeric address
+    //! \param[in] port - Host port (in host byte order)
+    //! \param[in] timeout - Maximum time to spend, measured from the call. Resolution counts against it but cannot be 
+    //!                      interrupted, so a slow resolver may overrun it before the connection attempts are abandoned.
+    //! \param[in] nonblocking - [optional] Whether the connected socket should remain non-blocking
+    //! \return socket_t - Connected socket
+    //!
+    //! \throw wtl::socket_error - Unable to resolve host, every attempt failed, or the deadline expired (WSAETIMEDOUT)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    socket_t connect(const String<Encoding::ANSI>& host, uint16_t port, clock_t::duration timeout, bool nonblocking = false)
+    {
+      Timing timing;
+      return connect(host, port, timeout, timing, nonblocking);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketConnector::connect
+    //! Connect to a host within a deadline, reporting how the connection was established
+    //!
+    //! \param[in] const& host - Host name or numeric address
+    //! \param[in] port - Host port (in host byte order)
+    //! \param[in] timeout - Maximum time to spend, measured from the call. Resolution counts against it but cannot be 
+    //!                      interrupted, so a slow resolver may overrun it before the connection attempts are abandoned.
+    //! \param[out] &timing - Connection timing
+    //! \param[in] nonblocking - [optional] Whether the connected socket should remain non-blocking
+    //! \return socket_t - Connected socket
+    //!
+    //! \throw wtl::socket_error - Unable to resolve host, every attempt failed, or the deadline expired (WSAETIMEDOUT)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    socket_t connect(const String<Encoding::ANSI>& host, uint16_t port, clock_t::duration timeout, Timing& timing, bool nonblocking = false)
+    {
+      const clock_t::time_point start = clock_t::now(),
+                                deadline = start + timeout;
+
+      // Resolve host
+      const auto candidates = Names.resolve(host, port);
+      const clock_t::time_point resolved = clock_t::now();
+      timing = Timing { resolved - start, clock_t::duration::zero(), static_cast<uint32_t>(candidates.size()), 0, address_t {} };
+
+      std::vector<Attempt> pending;
+      clock_t::time_point nextAttempt = resolved;
+      int32_t error = WSAETIMEDOUT;
+
+      for (size_t next = 0; ; )
+      {
+        const clock_t::time_point now = clock_t::now();
+
+        // [DEADLINE] Abandon attempts in progress
+        if (now >= deadline)
+        {
+          ::WSASetLastError(WSAETIMEDOUT);
+          throw socket_error(HERE, "Timed out connecting to host: " + host);
+        }
+
+        // Start next attempt once the previous has had its head start, or has failed
+        if (next < candidates.size() && pending.size() < FD_SETSIZE && (now >= nextAttempt || pending.empty()))
+        {
+          socket_t s(SocketType::Stream, SocketProtocol::Tcp);
+          s.nonblocking();
+          ++timing.Attempts;
+
+          if (s.connect(candidates[next]))
+            pending.push_back(Attempt { s, candidates[next] });
+          else
+            error = ::WSAGetLastError();
+
+          ++next;
+          nextAttempt = pending.empty() ? now : now + HeadStart;
+          continue;
+        }
+
+        // [EXHAUSTED] Report error of the last attempt to fail
+        if (pending.empty())
+        {
+          ::WSASetLastError(error);
+          throw socket_error(HERE, "Unable to connect to host: " + host);
+        }
+
+        // Wait for an attempt to complete, the next attempt to become due, or the deadline
+        const clock_t::time_point until = next < candidates.size() ? std::min(nextAttempt, deadline) : deadline;
+        // Clamp at zero, since the next attempt may be overdue while FD_SETSIZE attempts are pending
+        const auto wait = std::max<std::chrono::microseconds::rep>(0, std::chrono::duration_cast<std::chrono::microseconds>(until - now).count());
+        ::timeval tv { static_cast<long>(wait / 1000000), static_cast<long>(wait % 1000000) };
+
+        ::fd_set writable, failed;
+        FD_ZERO(&writable);
+        FD_ZERO(&failed);
+        for (const Attempt& a : pending)
+        {
+          FD_SET(a.Socket.handle(), &writable);
+          FD_SET(a.Socket.handle(), &failed);
+        }
+
+        if (::select(0, nullptr, &writable, &failed, &tv) == SOCKET_ERROR)
+          throw socket_error(HERE, "Unable to wait for connection");
+
+        // Collect completed attempts
+        for (auto a = pending.begin(); a != pending.end(); )
+        {
+          const bool completed = FD_ISSET(a->Socket.handle(), &writable) != 0,
+                     refused = FD_ISSET(a->Socket.handle(), &failed) != 0;
+          int32_t status = 0,
+                  length = sizeof(status);
+
+          if (!completed && !refused)
+          {
+            ++a;
+            continue;
+          }
+
+          // Query outcome, as some stacks report failure as writability
+          if (::getsockopt(a->Socket.handle(), SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&status), &length) == SOCKET_ERROR)
+            status = ::WSAGetLastError();
+
+          // [CONNECTED] Close remaining attempts
+          if (completed && !status)
+          {
+            timing.Connection = clock_t::now() - resolved;
+            timing.Address = a->Address;
+
+            socket_t winner = a->Socket;
+            if (!nonblocking)
+              winner.blocking();
+            return winner;
+          }
+
+          // [FAILED] Start next attempt without waiting
+          error = status ? status : WSAECONNREFUSED;
+          a = pending.erase(a);
+          nextAttempt = clock_t::now();
+        }
+      }
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_SOCKET_CONNECTOR_HPP
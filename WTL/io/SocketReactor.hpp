@@ -0,0 +1,465 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SocketReactor.hpp
+//! \brief Provides an event loop that dispatches socket readiness without a window message loop
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOCKET_REACTOR_HPP
+#define WTL_SOCKET_REACTOR_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Socket.hpp>                    //!< Socket, SocketBuffer
+#include <wtl/threads/WorkerThread.hpp>         //!< WorkerThread
+#include <atomic>                               //!< std::atomic
+#include <exception>                            //!< std::exception_ptr
+#include <functional>                           //!< std::function
+#include <memory>                               //!< std::shared_ptr
+#include <mutex>                                //!< std::mutex
+#include <unordered_map>                        //!< std::unordered_map
+#include <vector>                               //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketReactor - Event loop that owns many non-blocking sockets and dispatches their readiness
+  //!
+  //! \remarks The reactor waits upon every registered socket with a single WSAPoll call on its own thread,
+  //! \remarks  then invokes the callbacks of all ready sockets as one batch before waiting again. Readiness is
+  //! \remarks  level-triggered: callbacks are repeated until the socket is read/written or its interest changed.
+  //!
+  //! \remarks Readiness is reported using SocketEvent flags, so handlers written for WSAAsyncSelect notifications
+  //! \remarks  port directly. Listening sockets report pending connections as SocketEvent::Read; sockets completing
+  //! \remarks  a non-blocking connect report SocketEvent::Write; hang-ups and errors report SocketEvent::Close.
+  //!
+  //! \remarks Sockets may be added, modified and removed from any thread, including from within callbacks. A
+  //! \remarks  socket removed by a callback receives no further callbacks, even within the current batch.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct SocketReactor
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketReactor;
+
+    //! \alias callback_t - Readiness callback, invoked upon the reactor thread
+    using callback_t = std::function<void (::SOCKET, SocketEvent)>;
+
+    //! \alias task_t - Task invoked upon the reactor thread
+    using task_t = std::function<void ()>;
+
+  protected:
+    //! \alias handler_t - Shared callback, kept alive while executing even if its socket is removed
+    using handler_t = std::shared_ptr<callback_t>;
+
+    //! \struct Registration - Socket state owned by the reactor thread
+    struct Registration
+    {
+      HSocket    Handle;      //!< Shared socket handle
+      handler_t  Handler;     //!< Readiness callback
+    };
+
+    //! \enum Operation - Registration change
+    enum class Operation { Add, Modify, Remove };
+
+    //! \struct Change - Registration change requested from another thread
+    struct Change
+    {
+      Operation    Op;        //!< Operation
+      HSocket      Handle;    //!< Socket handle
+      SocketEvent  Interest;  //!< [Add/Modify] Requested notifications
+      handler_t    Handler;   //!< [Add] Readiness callback
+    };
+
+    //! \struct Ready - Readiness of one socket within a batch
+    struct Ready
+    {
+      ::SOCKET     Socket;    //!< Socket handle
+      SocketEvent  Events;    //!< Notifications
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<::WSAPOLLFD>              Descriptors;    //!< Poll set; the first descriptor is the wake socket
+    std::vector<Registration>             Registrations;  //!< Socket state, parallel to 'Descriptors'
+    std::unordered_map<::SOCKET,size_t>   Index;          //!< Position of each socket within 'Descriptors'
+    std::vector<Ready>                    Batch;          //!< Ready sockets of the current batch
+
+    std::mutex                            Mutex;          //!< Guards 'Changes', 'Tasks' and 'Error'
+    std::vector<Change>                   Changes;        //!< Changes requested from other threads
+    std::vector<task_t>                   Tasks;          //!< Tasks posted from other threads
+    std::exception_ptr                    Error;          //!< Exception that stopped the reactor thread
+
+    Socket<AddressFamily::IPv4>           Wake;           //!< Loopback datagram socket connected to itself
+    std::atomic<bool>                     Signalled,      //!< Whether a wake datagram is pending
+                                          Stopping;       //!< Whether the reactor thread should exit
+    std::atomic<uint64_t>                 Polls,          //!< Number of WSAPoll calls
+                                          Events;         //!< Number of callbacks invoked
+    WorkerThread                          Thread;         //!< Reactor thread
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::SocketReactor
+    //! Create the wake socket and start the reactor thread
+    //!
+    //! \param[in] capacity - [optional] Expected number of sockets  (Default is 1024)
+    //!
+    //! \throw wtl::socket_error - Unable to create wake socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    SocketReactor(uint32_t capacity = 1024)
+      : Wake(SocketType::Datagram, SocketProtocol::Udp),
+        Signalled(false),
+        Stopping(false),
+        Polls(0),
+        Events(0)
+    {
+      // Connect wake socket to itself upon an ephemeral loopback port
+      ::SOCKADDR_IN addr {};
+      ::INT length = sizeof(addr);
+      addr.sin_family = AF_INET;
+      addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+      if (::bind(Wake.handle(), reinterpret_cast<SOCKADDR*>(&addr), sizeof(addr)) == SOCKET_ERROR
+       || ::getsockname(Wake.handle(), reinterpret_cast<SOCKADDR*>(&addr), &length) == SOCKET_ERROR
+       || ::connect(Wake.handle(), reinterpret_cast<SOCKADDR*>(&addr), sizeof(addr)) == SOCKET_ERROR)
+        throw socket_error(HERE, "Unable to create reactor wake socket");
+      Wake.nonblocking();
+
+      Descriptors.reserve(capacity + 1);
+      Registrations.reserve(capacity + 1);
+      Index.reserve(capacity);
+      Descriptors.push_back({ Wake.handle(), POLLRDNORM, 0 });
+      Registrations.push_back({ Wake.handle(), nullptr });
+
+      // Start reactor thread last
+      Thread = WorkerThread(&SocketReactor::run, this);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(SocketReactor);      //!< Cannot be copied
+    DISABLE_MOVE(SocketReactor);      //!< Cannot be moved; the reactor thread refers to it
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::~SocketReactor
+    //! Stops the reactor thread, ignoring any error that stopped it, and releases every socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~SocketReactor()
+    {
+      try
+      {
+        stop();
+      }
+      catch (...)
+      {}
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::callbacks const
+    //! Get the number of readiness callbacks invoked
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t callbacks() const
+    {
+      return Events;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::polls const
+    //! Get the number of batches, ie. WSAPoll calls. The ratio of callbacks to polls is the mean batch size.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t polls() const
+    {
+      return Polls;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::add
+    //! Makes a socket non-blocking and registers it, sharing ownership of its handle until removed
+    //!
+    //! \tparam FAMILY - Address family
+    //!
+    //! \param[in,out] &s - Socket
+    //! \param[in] interest - Requested notifications  (Read, Write and/or Accept)
+    //! \param[in] const& callback - Readiness callback, invoked upon the reactor thread
+    //!
+    //! \throw wtl::socket_error - Unable to make socket non-blocking
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <AddressFamily FAMILY>
+    void add(Socket<FAMILY>& s, SocketEvent interest, const callback_t& callback)
+    {
+      s.nonblocking();
+      submit({ Operation::Add, s.handle(), interest, std::make_shared<callback_t>(callback) });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::modify
+    //! Changes the notifications requested for a registered socket
+    //!
+    //! \param[in] const& s - Socket handle
+    //! \param[in] interest - Requested notifications  (Read, Write and/or Accept)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void modify(const HSocket& s, SocketEvent interest)
+    {
+      submit({ Operation::Modify, s, interest, nullptr });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::post
+    //! Invokes a task upon the reactor thread after the current batch
+    //!
+    //! \param[in] const& task - Task
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void post(const task_t& task)
+    {
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Tasks.push_back(task);
+      }
+      wake();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::remove
+    //! Unregisters a socket, releasing the reactor's share of its handle
+    //!
+    //! \param[in] const& s - Socket handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void remove(const HSocket& s)
+    {
+      submit({ Operation::Remove, s, SocketEvent::Read, nullptr });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::stop
+    //! Stops the reactor thread and releases every socket
+    //!
+    //! \throw wtl::socket_error - WSAPoll failed, stopping the reactor thread
+    //! \throw ... - Exception thrown by a callback or task, stopping the reactor thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void stop()
+    {
+      if (Thread.joinable())
+      {
+        Stopping = true;
+        wake();
+        Thread.join();
+
+        Descriptors.resize(1);
+        Registrations.resize(1);
+        Index.clear();
+      }
+
+      // Rethrow error that stopped the thread, once
+      std::exception_ptr error;
+      std::swap(error, Error);
+      if (error)
+        std::rethrow_exception(error);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::apply
+    //! Applies a registration change upon the reactor thread
+    //!
+    //! \param[in] const& c - Change
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void apply(const Change& c)
+    {
+      const ::SOCKET s = c.Handle;
+      auto existing = Index.find(s);
+
+      switch (c.Op)
+      {
+      case Operation::Add:
+        if (existing != Index.end())
+        {
+          Descriptors[existing->second].events = interest(c.Interest);
+          Registrations[existing->second].Handler = c.Handler;
+          return;
+        }
+        Index.emplace(s, Descriptors.size());
+        Descriptors.push_back({ s, interest(c.Interest), 0 });
+        Registrations.push_back({ c.Handle, c.Handler });
+        return;
+
+      case Operation::Modify:
+        if (existing != Index.end())
+          Descriptors[existing->second].events = interest(c.Interest);
+        return;
+
+      case Operation::Remove:
+        if (existing != Index.end())
+        {
+          // Swap with last descriptor
+          const size_t idx = existing->second;
+          Index.erase(existing);
+          if (idx != Descriptors.size() - 1)
+          {
+            Descriptors[idx] = Descriptors.back();
+            Registrations[idx] = std::move(Registrations.back());
+            Index[Descriptors[idx].fd] = idx;
+          }
+          Descriptors.pop_back();
+          Registrations.pop_back();
+        }
+        return;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::dispatch
+    //! Invokes the callbacks of the current batch
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void dispatch()
+    {
+      for (const Ready& r : Batch)
+      {
+        // Skip sockets removed by an earlier callback of this batch
+        auto pos = Index.find(r.Socket);
+        if (pos == Index.end())
+          continue;
+
+        handler_t handler = Registrations[pos->second].Handler;
+        (*handler)(r.Socket, r.Events);
+        ++Events;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::drain
+    //! Applies changes and runs tasks requested from other threads
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void drain()
+    {
+      std::vector<Change> changes;
+      std::vector<task_t> tasks;
+
+      // Consume wake datagrams before collecting requests, so a request queued meanwhile sends another
+      Signalled = false;
+      char buf[16];
+      while (::recv(Wake.handle(), buf, sizeof(buf), 0) > 0)
+      {}
+
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        std::swap(changes, Changes);
+        std::swap(tasks, Tasks);
+      }
+
+      for (const Change& c : changes)
+        apply(c);
+      for (const task_t& t : tasks)
+        t();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::interest
+    //! Convert requested notifications to WSAPoll events
+    //!
+    //! \param[in] ev - Requested notifications
+    //! \return SHORT - WSAPoll events
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static ::SHORT interest(SocketEvent ev)
+    {
+      ::SHORT events = 0;
+      if (enum_cast(ev & (SocketEvent::Read|SocketEvent::Accept|SocketEvent::Close)) != 0)
+        events |= POLLRDNORM;
+      if (enum_cast(ev & (SocketEvent::Write|SocketEvent::Connect)) != 0)
+        events |= POLLWRNORM;
+      return events;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::readiness
+    //! Convert WSAPoll results to notifications
+    //!
+    //! \param[in] revents - WSAPoll results
+    //! \return SocketEvent - Notifications
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static SocketEvent readiness(::SHORT revents)
+    {
+      uint32_t ev = 0;
+      if (revents & POLLRDNORM)
+        ev |= enum_cast(SocketEvent::Read);
+      if (revents & POLLWRNORM)
+        ev |= enum_cast(SocketEvent::Write);
+      if (revents & (POLLHUP|POLLERR|POLLNVAL))
+        ev |= enum_cast(SocketEvent::Close);
+      return static_cast<SocketEvent>(ev);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::run
+    //! Reactor thread procedure
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void run()
+    {
+      try
+      {
+        while (!Stopping)
+        {
+          drain();
+
+          // Wait for readiness of any socket, or a wake datagram
+          int n = ::WSAPoll(Descriptors.data(), static_cast<::ULONG>(Descriptors.size()), -1);
+          if (n == SOCKET_ERROR)
+            throw socket_error(HERE, "Unable to poll sockets");
+          ++Polls;
+
+          // Collect batch before dispatching, as callbacks may reorder the poll set
+          Batch.clear();
+          for (size_t idx = 1; idx < Descriptors.size() && n > 0; ++idx)
+            if (::SHORT revents = Descriptors[idx].revents)
+            {
+              Batch.push_back({ Descriptors[idx].fd, readiness(revents) });
+              Descriptors[idx].revents = 0;
+              --n;
+            }
+          dispatch();
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Error = std::current_exception();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::submit
+    //! Applies a registration change immediately upon the reactor thread, otherwise queues it and wakes the thread
+    //!
+    //! \param[in] && c - Change
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void submit(Change&& c)
+    {
+      if (std::this_thread::get_id() == Thread.get_id())
+        return apply(c);
+
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Changes.push_back(std::move(c));
+      }
+      wake();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::wake
+    //! Wakes the reactor thread, sending at most one datagram until the thread consumes it
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void wake()
+    {
+      if (!Signalled.exchange(true))
+        ::send(Wake.handle(), "", 1, 0);
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_SOCKET_REACTOR_HPP
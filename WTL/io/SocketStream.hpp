@@ -0,0 +1,565 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SocketStream.hpp
+//! \brief Provides buffered socket streams for use with TextReader, BinaryReader, XmlReader and the writers
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOCKET_STREAM_HPP
+#define WTL_SOCKET_STREAM_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/Socket.hpp>                    //!< Socket, SocketBuffer
+#include <algorithm>                            //!< std::min
+#include <cstring>                              //!< std::memcpy, std::memchr
+#include <memory>                               //!< std::shared_ptr
+#include <vector>                               //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketInputStream - Buffered input stream that receives from a connected socket
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Input is received with large reads into a window from which readers parse in place. buffer() and
+  //! \remarks  remaining() describe received input only, so protocol code calls fill() or fillUntil() to ensure a
+  //! \remarks  whole message is buffered before parsing it; read() and get() wait for input themselves.
+  //!
+  //! \remarks Copies share the socket and window, so protocol code may keep a copy to fill the stream of a reader.
+  //! \remarks  The window is followed by a null terminator, as required by the regex matching of TextReader.
+  //! \remarks  Receiving more input may move unread input to the start of the window, invalidating views.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct SocketInputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketInputStream<FAMILY>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef int32_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef char element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef uint64_t position_t;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+  protected:
+    //! \struct State - Socket and window shared by copies
+    struct State
+    {
+      socket_t                Socket;     //!< Connected socket
+      std::vector<element_t>  Window;     //!< Received input, followed by a null terminator
+      uint32_t                Begin,      //!< Position of first unread element within 'Window'
+                              End;        //!< Position following last received element within 'Window'
+      position_t              Consumed;   //!< Number of elements preceding 'Window'
+      bool                    Closed;     //!< Whether the peer has closed the connection
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<State>  Shared;       //!< Shared state
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::SocketInputStream
+    //! Create from a connected socket
+    //!
+    //! \param[in] const& socket - Connected blocking socket  (Shares its handle)
+    //! \param[in] capacity - [optional] Capacity of the window, in bytes  (Default is 64KB)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    SocketInputStream(const socket_t& socket, uint32_t capacity = 64*1024)
+      : Shared(std::make_shared<State>(State { socket, std::vector<element_t>(capacity + 1), 0, 0, 0, false }))
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(SocketInputStream);     //!< Copies share the socket and window
+    ENABLE_MOVE(SocketInputStream);     //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::buffer const
+    //! Get the first unread element, for parsing in place
+    //!
+    //! \return const element_t* - Unread input of 'remaining()' elements, followed by a null terminator
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const element_t* buffer() const
+    {
+      return Shared->Window.data() + Shared->Begin;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::closed const
+    //! Query whether the peer has closed the connection. Buffered input may remain.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool closed() const
+    {
+      return Shared->Closed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::position const
+    //! Get the number of elements consumed since the stream was created
+    /////////////////////////////////////////////////////////////////////////////////////////
+    position_t position() const
+    {
+      return Shared->Consumed + Shared->Begin;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::remaining const
+    //! Get the number of received elements that have not been consumed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(Shared->End - Shared->Begin);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::fill
+    //! Receives input until at least a number of unread elements are buffered, reading as much as fits each time
+    //!
+    //! \param[in] minimum - [optional] Minimum number of unread elements  (Default is one)
+    //! \return bool - True if buffered, false if the peer closed the connection first
+    //!
+    //! \throw wtl::length_error - Minimum exceeds window capacity
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool fill(uint32_t minimum = 1)
+    {
+      State& s = *Shared;
+      if (minimum > s.Window.size() - 1)
+        throw wtl::length_error(HERE, "Socket stream window cannot hold ", minimum, " elements");
+
+      while (s.End - s.Begin < minimum)
+        if (!receive())
+          return false;
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::fillUntil
+    //! Receives input until a delimiter is buffered
+    //!
+    //! \param[in] delim - Delimiter
+    //! \return distance_t - Number of unread elements preceding the delimiter, or -1 if the peer closed the connection first
+    //!
+    //! \throw wtl::length_error - Window is full without a delimiter
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    distance_t fillUntil(element_t delim)
+    {
+      State& s = *Shared;
+
+      // Search only newly received input on each iteration
+      for (uint32_t searched = 0; ; )
+      {
+        const element_t* first = s.Window.data() + s.Begin;
+        if (const void* match = std::memchr(first + searched, delim, s.End - s.Begin - searched))
+          return static_cast<distance_t>(static_cast<const element_t*>(match) - first);
+
+        searched = s.End - s.Begin;
+        if (searched == s.Window.size() - 1)
+          throw wtl::length_error(HERE, "Socket stream window is full without a delimiter");
+        if (!receive())
+          return -1;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::get
+    //! Reads a single element, waiting for input if necessary
+    //!
+    //! \return element_t - Element
+    //!
+    //! \throw wtl::domain_error - Connection closed
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    element_t get()
+    {
+      if (!fill(1))
+        throw wtl::domain_error(HERE, "Connection closed");
+
+      return Shared->Window[Shared->Begin++];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::read
+    //! Reads a buffer of elements, waiting for input if necessary
+    //!
+    //! \param[in,out] *buf - Buffer
+    //! \param[in] length - Number of bytes
+    //!
+    //! \throw wtl::domain_error - Connection closed
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void read(ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Socket streams require single-byte elements");
+      State& s = *Shared;
+
+      for (uint32_t chunk; length; buf += chunk, length -= chunk)
+      {
+        if (!fill(1))
+          throw wtl::domain_error(HERE, "Connection closed");
+
+        chunk = std::min(length, s.End - s.Begin);
+        std::memcpy(buf, s.Window.data() + s.Begin, chunk);
+        s.Begin += chunk;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::read
+    //! Reads all elements of statically allocated array
+    //!
+    //! \param[in,out] (&)[] arr - Statically allocated array of elements
+    //!
+    //! \throw wtl::domain_error - Connection closed
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void read(element_t (&arr)[LENGTH])
+    {
+      read(arr, LENGTH);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::release
+    //! Consumes elements parsed in place
+    //!
+    //! \param[in] length - Number of elements
+    //!
+    //! \throw wtl::length_error - [Debug only] Exceeds unread elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      Shared->Begin += length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::seek
+    //! Moves the read position within the window
+    //!
+    //! \param[in] offset - Offset, in elements
+    //! \param[in] mode - Origin  (Begin is relative to the start of the stream)
+    //! \return position_t - New position, relative to the start of the stream
+    //!
+    //! \throw wtl::out_of_range - Position has been discarded, has not been received, or is relative to the end
+    /////////////////////////////////////////////////////////////////////////////////////////
+    position_t seek(int64_t offset, FileSeek mode)
+    {
+      State& s = *Shared;
+      const int64_t target = (mode == FileSeek::Begin   ? 0
+                           :  mode == FileSeek::Current ? static_cast<int64_t>(position())
+                           :                              -1) + offset;
+
+      // Only positions within the window may be reached; the end of a socket stream is unknown
+      if (mode == FileSeek::End || target < static_cast<int64_t>(s.Consumed) || target > static_cast<int64_t>(s.Consumed + s.End))
+        throw wtl::out_of_range(HERE, "Socket stream position ", target, " is outside the window");
+
+      s.Begin = static_cast<uint32_t>(target - s.Consumed);
+      return position();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketInputStream::receive
+    //! Receives as much input as fits the window with one call, first moving unread input to the start if necessary
+    //!
+    //! \return bool - True if input was received, false if the peer has closed the connection
+    //!
+    //! \throw wtl::socket_error - Failed to receive data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool receive()
+    {
+      State& s = *Shared;
+      if (s.Closed)
+        return false;
+
+      const uint32_t capacity = static_cast<uint32_t>(s.Window.size() - 1);
+
+      // Compact once less than half the window is free
+      if (s.Begin != 0 && capacity - s.End < capacity / 2)
+      {
+        std::memmove(s.Window.data(), s.Window.data() + s.Begin, s.End - s.Begin);
+        s.Consumed += s.Begin;
+        s.End -= s.Begin;
+        s.Begin = 0;
+      }
+
+      int32_t n = s.Socket.receive(s.Window.data() + s.End, capacity - s.End);
+      s.End += n;
+      s.Window[s.End] = '\0';
+      s.Closed = (n == 0);
+      return n != 0;
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketOutputStream - Buffered output stream that sends to a connected socket
+  //!
+  //! \tparam FAMILY - [optional] Address family, defaults to IPv4
+  //!
+  //! \remarks Output is batched until half the buffer is used, so writers may always format directly into at least
+  //! \remarks  half the buffer. Writes larger than that are sent together with pending output using one gather
+  //! \remarks  operation rather than being copied. flush() sends pending output immediately.
+  //!
+  //! \remarks Copies share the socket and buffer, so protocol code may keep a copy to flush the stream of a writer.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <AddressFamily FAMILY = AddressFamily::IPv4>
+  struct SocketOutputStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketOutputStream<FAMILY>;
+
+    //! \typedef distance_t - Stream distance type
+    typedef int32_t distance_t;
+
+    //! \typedef element_t - Stream element type
+    typedef char element_t;
+
+    //! \typedef position_t - Stream position type
+    typedef uint64_t position_t;
+
+    //! \alias socket_t - Socket type
+    using socket_t = Socket<FAMILY>;
+
+  protected:
+    //! \struct State - Socket and buffer shared by copies
+    struct State
+    {
+      socket_t                Socket;     //!< Connected socket
+      std::vector<element_t>  Output;     //!< Pending output
+      uint32_t                Used;       //!< Number of elements pending
+      position_t              Sent;       //!< Number of elements sent
+      bool                    Closed;     //!< Whether stream has been closed
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<State>  Shared;       //!< Shared state
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::SocketOutputStream
+    //! Create from a connected socket
+    //!
+    //! \param[in] const& socket - Connected blocking socket  (Shares its handle)
+    //! \param[in] capacity - [optional] Capacity of the buffer, in bytes  (Default is 64KB)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    SocketOutputStream(const socket_t& socket, uint32_t capacity = 64*1024)
+      : Shared(std::make_shared<State>(State { socket, std::vector<element_t>(capacity), 0, 0, false }))
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(SocketOutputStream);    //!< Copies share the socket and buffer
+    ENABLE_MOVE(SocketOutputStream);    //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::position const
+    //! Get the number of elements written since the stream was created
+    /////////////////////////////////////////////////////////////////////////////////////////
+    position_t position() const
+    {
+      return Shared->Sent + Shared->Used;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::remaining const
+    //! Get the free space within the buffer, for writing directly
+    //!
+    //! \return distance_t - Free space  (Always at least half the buffer)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    distance_t remaining() const
+    {
+      return static_cast<distance_t>(Shared->Output.size() - Shared->Used);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::used const
+    //! Get the number of elements pending
+    /////////////////////////////////////////////////////////////////////////////////////////
+    distance_t used() const
+    {
+      return static_cast<distance_t>(Shared->Used);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::buffer
+    //! Get the free space within the buffer, for writing directly
+    //!
+    //! \return element_t* - Free space of 'remaining()' elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    element_t* buffer()
+    {
+      return Shared->Output.data() + Shared->Used;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::close
+    //! Sends pending output then shuts down the sending side of the connection
+    //!
+    //! \throw wtl::logic_error - Stream has been closed
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      if (Shared->Closed)
+        throw wtl::logic_error(HERE, "Stream has been closed");
+
+      flush();
+      Shared->Closed = true;
+      ::shutdown(Shared->Socket.handle(), SD_SEND);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::flush
+    //! Sends pending output
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void flush()
+    {
+      send(nullptr, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::put
+    //! Writes a single element
+    //!
+    //! \param[in] element - Element
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void put(element_t element)
+    {
+      *buffer() = element;
+      release(1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::release
+    //! Commits elements written directly into the buffer, sending them once half the buffer is used
+    //!
+    //! \param[in] length - Number of elements
+    //!
+    //! \throw wtl::length_error - [Debug only] Exceeds free space
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void release(uint32_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+
+      State& s = *Shared;
+      s.Used += length;
+      if (s.Used >= s.Output.size() / 2)
+        flush();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::write
+    //! Writes a buffer of elements, batching small writes and sending large writes without copying
+    //!
+    //! \param[in] const* buf - Buffer
+    //! \param[in] length - Number of elements
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ELEMENT>
+    void write(const ELEMENT* buf, uint32_t length)
+    {
+      static_assert(sizeof(ELEMENT) == 1, "Socket streams require single-byte elements");
+      State& s = *Shared;
+
+      // [LARGE] Send with pending output
+      if (length >= s.Output.size() / 2)
+        return send(reinterpret_cast<const element_t*>(buf), length);
+
+      std::memcpy(buffer(), buf, length);
+      release(length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::write
+    //! Writes all elements of statically allocated array
+    //!
+    //! \param[in] const (&)[] arr - Statically allocated array of elements
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void write(const element_t (&arr)[LENGTH])
+    {
+      write(arr, LENGTH);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketOutputStream::send
+    //! Sends pending output followed by an optional buffer, resuming after partial sends
+    //!
+    //! \param[in] const* buf - [optional] Buffer
+    //! \param[in] length - Number of elements in 'buf'
+    //!
+    //! \throw wtl::socket_error - Failed to send data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void send(const element_t* buf, uint32_t length)
+    {
+      State& s = *Shared;
+      SocketBuffer bufs[] = { SocketBuffer(s.Output.data(), s.Used), SocketBuffer(buf, length) };
+
+      for (SocketBuffer* first = bufs, *last = bufs + (length ? 2 : 1); first != last; )
+      {
+        // Skip exhausted buffers
+        if (first->len == 0)
+        {
+          ++first;
+          continue;
+        }
+
+        // Advance through buffers by the number of bytes sent
+        uint32_t n = static_cast<uint32_t>(s.Socket.send(first, static_cast<uint32_t>(last - first)));
+        for (s.Sent += n; n != 0; )
+        {
+          uint32_t consumed = std::min<uint32_t>(n, first->len);
+          first->buf += consumed;
+          first->len -= consumed;
+          n -= consumed;
+          if (first->len == 0)
+            ++first;
+        }
+      }
+      s.Used = 0;
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_SOCKET_STREAM_HPP
@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\StreamView.hpp
+//! \brief Provides non-owning views of elements held within a stream buffer
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_STREAM_VIEW_HPP
+#define WTL_STREAM_VIEW_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>            //!< std::equal
+#include <memory>               //!< std::shared_ptr, std::weak_ptr
+#include <string>               //!< std::basic_string
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ViewSource - Lifetime token owned by readers that hand out stream views
+  //!
+  //! \remarks In development mode views hold a weak reference to this token and verify it upon access. The token is
+  //! \remarks replaced whenever the reader is copied or assigned, and expires when the reader is destroyed. In release
+  //! \remarks mode it is empty.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct ViewSource
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+//! \if DEVELOPMENT_MODE - Track view lifetime
+#ifdef DEVELOPMENT_MODE
+    std::shared_ptr<char>  Token;     //!< Token observed by views
+#endif
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ViewSource::ViewSource
+    //! Create new lifetime token
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ViewSource()
+#ifdef DEVELOPMENT_MODE
+      : Token(std::make_shared<char>())
+#endif
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ViewSource::ViewSource
+    //! Copies receive a new token; views of the original do not refer to the copy's stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ViewSource(const ViewSource& r) : ViewSource()
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ViewSource::operator=
+    //! Assignment overwrites the stream, invalidating existing views
+    //!
+    //! \return ViewSource& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ViewSource& operator=(const ViewSource& r)
+    {
+      invalidate();
+      return *this;
+    }
+
+    ENABLE_MOVE(ViewSource);      //!< Views follow the moved token
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ViewSource::invalidate
+    //! Invalidates all existing views, eg. when the stream buffer is refilled or relocated
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void invalidate()
+    {
+#ifdef DEVELOPMENT_MODE
+      Token = std::make_shared<char>();
+#endif
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct StreamView - Immutable, non-owning view of a contiguous run of elements within a stream buffer
+  //!
+  //! \tparam T - Element type
+  //!
+  //! \remarks Views remain valid until the reader that produced them is destroyed or assigned, or the stream
+  //! \remarks buffer is refilled. In development mode accessing an invalid view throws wtl::logic_error.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct StreamView
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = StreamView<T>;
+
+    //! \alias value_type - Element type
+    using value_type = T;
+
+    //! \alias const_iterator - Element iterator
+    using const_iterator = const T*;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    const T*  Data;       //!< First element
+    uint32_t  Length;     //!< Number of elements
+
+#ifdef DEVELOPMENT_MODE
+    std::weak_ptr<char>  Source;     //!< Lifetime token of the producing reader
+#endif
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::StreamView
+    //! Create empty view
+    /////////////////////////////////////////////////////////////////////////////////////////
+    StreamView() : Data(nullptr), Length(0)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::StreamView
+    //! Create view of elements within a stream buffer
+    //!
+    //! \param[in] const* data - First element
+    //! \param[in] length - Number of elements
+    //! \param[in] const& src - Lifetime token of the producing reader
+    /////////////////////////////////////////////////////////////////////////////////////////
+    StreamView(const T* data, uint32_t length, const ViewSource& src) : Data(data),
+                                                                        Length(length)
+#ifdef DEVELOPMENT_MODE
+                                                                      , Source(src.Token)
+#endif
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    ENABLE_COPY(StreamView);      //!< Can be shallow copied
+    ENABLE_MOVE(StreamView);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::begin const
+    //! Get position of first element
+    //!
+    //! \return const_iterator - Position of first element
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator begin() const
+    {
+      verify();
+      return Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::end const
+    //! Get position beyond last element
+    //!
+    //! \return const_iterator - Position beyond last element
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator end() const
+    {
+      verify();
+      return Data + Length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::data const
+    //! Get the elements
+    //!
+    //! \return const T* - Pointer to first element
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const T* data() const
+    {
+      verify();
+      return Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::empty const
+    //! Query whether view is empty
+    //!
+    //! \return bool - True iff view contains no elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool empty() const
+    {
+      return Length == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::size const
+    //! Get the number of elements
+    //!
+    //! \return uint32_t - Number of elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t size() const
+    {
+      return Length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::str const
+    //! Copy the elements into a string
+    //!
+    //! \return std::basic_string<T> - Copy of elements
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::basic_string<T> str() const
+    {
+      verify();
+      return std::basic_string<T>(Data, Length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::subview const
+    //! Get a view of a sub-range of elements
+    //!
+    //! \param[in] offset - Zero-based index of first element
+    //! \param[in] count - Number of elements
+    //! \return StreamView - View sharing the same lifetime
+    //!
+    //! \throw wtl::length_error - [Debug only] Sub-range exceeds view
+    /////////////////////////////////////////////////////////////////////////////////////////
+    StreamView subview(uint32_t offset, uint32_t count) const
+    {
+      CHECKED_LENGTH(offset + count, Length);
+
+      // Copy view, then narrow range
+      StreamView r(*this);
+      r.Data += offset;
+      r.Length = count;
+      return r;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::operator[] const
+    //! Access element by index
+    //!
+    //! \param[in] idx - Zero-based element index
+    //! \return const T& - Immutable reference to element
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    //! \throw wtl::out_of_range - [Debug only] Index out of bounds
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const T& operator[](uint32_t idx) const
+    {
+      CHECKED_INDEX(idx, 0, Length);
+
+      verify();
+      return Data[idx];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::operator== const
+    //! Element-wise equality
+    //!
+    //! \param[in] const& r - Another view
+    //! \return bool - True iff views have equal length and elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator==(const StreamView& r) const
+    {
+      return Length == r.Length && std::equal(begin(), end(), r.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::operator!= const
+    //! Element-wise inequality
+    //!
+    //! \param[in] const& r - Another view
+    //! \return bool - True iff views differ in length or elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator!=(const StreamView& r) const
+    {
+      return !operator==(r);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StreamView::verify const
+    //! Verifies the producing reader has not invalidated the view
+    //!
+    //! \throw wtl::logic_error - [Debug only] View has outlived its stream buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void verify() const
+    {
+#ifdef DEVELOPMENT_MODE
+      if (Data && Source.expired())
+        throw wtl::logic_error(HERE, "Stream view has outlived its stream buffer");
+#endif
+    }
+  };
+
+} //namespace wtl
+#endif // WTL_STREAM_VIEW_HPP
@@ -10,11 +10,18 @@
 #define WTL_TEXT_READER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/io/Scanner.hpp>         //!< Lexer, Token
+#include <wtl/io/StreamView.hpp>      //!< StreamView
+#include <wtl/utils/ByteSearch.hpp>   //!< find_byte
+#include <wtl/utils/FromChars.hpp>    //!< from_chars
+#include <string>                     //!< std::basic_string
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
-  
+  template <typename READER>
+  struct LineRange;
+
   //////////////////////////////////////////////////////////////////////////////////////////
 	//! \struct TextReader - Reads formatted text from an input stream
   //! 
@@ -51,7 +58,7 @@ namespace wtl
     //! \param[in,out] &&... args - Stream constructor arguments
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename... ARGS> explicit
-    TextReader(ARGS&&... args) : Stream(std::forward<ARGS>(args)...)
+    TextReader(ARGS&&... args) : Stream(std::forward<ARGS>(args)...), Unreleased(0)
     {}
     
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
@@ -78,6 +85,7 @@ namespace wtl
     bool match(const std::regex& regex)
     {
       std::cmatch match;
+      settle();
 
       // Match regex using direct stream access
       bool result = std::regex_search(Stream.buffer(), match, regex, std::regex_constants::match_continuous)
@@ -98,6 +106,7 @@ namespace wtl
     std::string read(const std::regex& regex)
     {
       std::cmatch match;
+      settle();
 
       // Match regex using direct stream access
       if (!std::regex_search(Stream.buffer(), match, regex, std::regex_constants::match_continuous))
@@ -113,6 +122,259 @@ namespace wtl
       return match[match.size()-1].str();
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::match
+    //! Matches a token rule without advancing the stream
+    //! 
+    //! \tparam RULE - Token rule  (eg. IdentifierRule, NumberRule, QuotedRule<'"'>)
+    //! 
+    //! \return bool - True if matched, otherwise false
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename RULE>
+    bool match()
+    {
+      settle();
+      const element_t* pos = Stream.buffer();
+
+      // Match rule using direct stream access
+      bool result = RULE::scan(pos, pos + Stream.remaining()) != nullptr;
+
+      // Cleanup 
+      Stream.release(0);
+      return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::read
+    //! Reads text matched by a token rule without copying it, and advances the stream beyond the match
+    //! 
+    //! \tparam RULE - Token rule  (eg. IdentifierRule, NumberRule, QuotedRule<'"'>)
+    //! 
+    //! \return StreamView<element_t> - View of matched text. This is not null terminated.
+    //! 
+    //! \throw wtl::domain_error - No match
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename RULE>
+    std::enable_if_t<!std::is_arithmetic<RULE>::value, StreamView<element_t>> read()
+    {
+      static_assert(std::is_same<element_t,char>::value, "Token rules require a narrow character stream");
+
+      settle();
+      const element_t* pos = Stream.buffer();
+      
+      // Match rule using direct stream access
+      const element_t* match = RULE::scan(pos, pos + Stream.remaining());
+      if (!match)
+        throw wtl::domain_error(HERE, "No match");
+
+      // Defer release of the match until the next read, in case releasing refills the buffer
+      Unreleased = static_cast<uint32_t>(match - pos);
+      return StreamView<element_t>(pos, Unreleased, Views);
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::read
+    //! Reads a decimal number in-place, and advances the stream beyond it
+    //! 
+    //! \tparam T - Integer or floating-point type  (eg. int32_t, uint64_t, double)
+    //! 
+    //! \param[in] mode - [optional] Strict mode rejects leading whitespace, a leading '+' and numbers immediately followed 
+    //!                   by a letter, digit, underscore or decimal point. Lenient mode accepts these, plus 'inf' and 'nan'.  (Default is strict)
+    //! \return T - Value, correctly rounded if floating-point
+    //! 
+    //! \throw wtl::domain_error - Not a number
+    //! \throw wtl::out_of_range - Number exceeds range of 'T'
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    enable_if_arithmetic_t<T,T> read(NumericMode mode = NumericMode::Strict)
+    {
+      static_assert(std::is_same<element_t,char>::value, "Numeric parsing requires a narrow character stream");
+
+      settle();
+      const element_t* pos = Stream.buffer();
+      T value = T();
+
+      // Convert using direct stream access
+      FromCharsResult result = from_chars(pos, pos + Stream.remaining(), value, mode);
+
+      // Release stream, advancing beyond number
+      Stream.release(static_cast<uint32_t>(result.Next - pos));
+
+      if (result.Error == ParseError::Invalid)
+        throw wtl::domain_error(HERE, "Not a number");
+      if (result.Error == ParseError::Overflow)
+        throw wtl::out_of_range(HERE, "Number exceeds range of destination type");
+      return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::readToken
+    //! Reads the longest token matched by any rule of a lexer, and advances the stream beyond the match
+    //! 
+    //! \tparam LEXER - Lexer type  (eg. Lexer<WhitespaceRule, IdentifierRule, NumberRule>)
+    //! 
+    //! \return Token<element_t> - Index of matching rule, and view of matched text
+    //! 
+    //! \throw wtl::domain_error - No match
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename LEXER>
+    Token<element_t> readToken()
+    {
+      static_assert(std::is_same<element_t,char>::value, "Token rules require a narrow character stream");
+
+      settle();
+      const element_t* pos = Stream.buffer();
+      uint32_t kind;
+      
+      // Match rules using direct stream access
+      const element_t* match = LEXER::scan(pos, pos + Stream.remaining(), kind);
+      if (!match)
+        throw wtl::domain_error(HERE, "No token matched");
+
+      // Defer release of the match until the next read, in case releasing refills the buffer
+      Unreleased = static_cast<uint32_t>(match - pos);
+      return Token<element_t> { kind, StreamView<element_t>(pos, Unreleased, Views) };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::readLine
+    //! Reads the next line, without copying it unless it spans a refill of the stream buffer, and advances the 
+    //! stream beyond its terminator. Lines are terminated by LF or CRLF; the final line need not be terminated.
+    //! 
+    //! \param[in,out] &line - On output, view of the line excluding its terminator
+    //! \return bool - True if a line was read, false if the stream is exhausted
+    //////////////////////////////////////////////////////////////////////////////////////////
+    bool readLine(StreamView<element_t>& line)
+    {
+      if (!readUntil('\n', line))
+        return false;
+
+      // [CRLF] Exclude carriage return, which is never separated from its line by a refill
+      if (!line.empty() && line[line.size()-1] == '\r')
+        line = line.subview(0, line.size()-1);
+      return true;
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::readUntil
+    //! Reads text up to a delimiter, and advances the stream beyond the delimiter. If the delimiter is 
+    //! absent the remainder of the stream is read.
+    //! 
+    //! \param[in] delim - Delimiter character
+    //! \param[in,out] &text - On output, view of the text excluding the delimiter
+    //! \return bool - True if text was read, false if the stream is exhausted
+    //!
+    //! \remarks Text within the stream buffer is viewed in-place, and released upon the next read. Text that spans
+    //! \remarks  a refill is gathered into an internal buffer. Either way the view remains valid until the next read.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    bool readUntil(element_t delim, StreamView<element_t>& text)
+    {
+      static_assert(std::is_same<element_t,char>::value, "Vectorized search requires a narrow character stream");
+      settle();
+
+      // [EXHAUSTED] Nothing to read
+      if (Stream.remaining() <= 0)
+        return false;
+
+      // Search buffer in-place
+      const element_t *pos = Stream.buffer(),
+                      *end = pos + Stream.remaining(),
+                      *delimiter = find_byte(pos, end, delim);
+
+      // [FOUND] View text in-place, deferring its release until the next read in case releasing refills the buffer
+      if (delimiter != end)
+      {
+        text = StreamView<element_t>(pos, static_cast<uint32_t>(delimiter - pos), Views);
+        Unreleased = static_cast<uint32_t>(delimiter - pos) + 1;
+        return true;
+      }
+
+      // [SPANNED] Gather text until the delimiter or the end of the stream, since releasing may refill the buffer
+      Views.invalidate();
+      Spanned.assign(pos, end);
+      Stream.release(static_cast<uint32_t>(end - pos));
+
+      while (Stream.remaining() > 0)
+      {
+        pos = Stream.buffer();
+        end = pos + Stream.remaining();
+        delimiter = find_byte(pos, end, delim);
+
+        Spanned.append(pos, delimiter);
+        Stream.release(static_cast<uint32_t>(delimiter - pos) + (delimiter != end ? 1 : 0));
+        if (delimiter != end)
+          break;
+      }
+
+      text = StreamView<element_t>(Spanned.data(), static_cast<uint32_t>(Spanned.size()), Views);
+      return true;
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::lines
+    //! Get an input range that reads successive lines
+    //! 
+    //! \return LineRange<TextReader> - Range of line views. eg. for (auto line : reader.lines())
+    //////////////////////////////////////////////////////////////////////////////////////////
+    LineRange<TextReader> lines()
+    {
+      return LineRange<TextReader>(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::read_view
+    //! Reads text matched by regular expression without copying it, and advances the stream beyond the match
+    //! 
+    //! \param[in] const& regex - Regular expression 
+    //! \return StreamView<element_t> - View of first capture group, if any, otherwise matched text. This is not null terminated.
+    //! 
+    //! \throw wtl::domain_error - No match
+    //////////////////////////////////////////////////////////////////////////////////////////
+    StreamView<element_t> read_view(const std::regex& regex)
+    {
+      std::cmatch match;
+      settle();
+      const element_t* pos = Stream.buffer();
+
+      // Match regex using direct stream access
+      if (!std::regex_search(pos, match, regex, std::regex_constants::match_continuous))
+      {
+        Stream.release(0);
+        throw wtl::domain_error(HERE, "No match");
+      }
+      
+      // Alias first capture group, if any, otherwise matched text
+      auto& group = match[match.size()-1];
+      StreamView<element_t> view(group.first, static_cast<uint32_t>(group.length()), Views);
+      
+      // Defer release of the match until the next read, in case releasing refills the buffer
+      Unreleased = static_cast<uint32_t>(match.length());
+      return view;
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::read_view
+    //! Reads a run of characters without copying them, and advances the stream beyond them
+    //! 
+    //! \param[in] length - Number of characters
+    //! \return StreamView<element_t> - View of characters. This is not null terminated.
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    StreamView<element_t> read_view(uint32_t length)
+    {
+      settle();
+      CHECKED_LENGTH(length, Stream.remaining());
+
+      // Alias characters in-place
+      StreamView<element_t> view(Stream.buffer(), length, Views);
+      
+      // Defer release of the characters until the next read, in case releasing refills the buffer
+      Unreleased = length;
+      return view;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // TextReader::read
     //! Reads text matched by regular expression, and advances the stream beyond the match
@@ -136,6 +398,7 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     element_t read()
     {
+      settle();
       CHECKED_LENGTH(Stream.remaining(), 1);
 
       // Read char
@@ -176,14 +439,110 @@ namespace wtl
     {
       // Avoid self-assignment, and copy stream
       if (static_cast<void*>(this) != static_cast<const void*>(&r))
+      {
         Stream = r.Stream;
+        Unreleased = r.Unreleased;
+        Views.invalidate();
+      }
 
       return *this;
     }
 
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextReader::settle
+    //! Releases text viewed in-place by the last read, before the stream is read again
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void settle()
+    {
+      if (Unreleased)
+      {
+        Stream.release(Unreleased);
+        Unreleased = 0;
+      }
+    }
+
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
-    stream_t   Stream;     //!< Input stream
+    stream_t                        Stream;     //!< Input stream
+    ViewSource                      Views;      //!< Lifetime of views upon the stream buffer
+    std::basic_string<element_t>    Spanned;    //!< Text that spanned a refill of the stream buffer
+    uint32_t                        Unreleased; //!< Length of text viewed in-place whose release is deferred
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LineRange - Input range that reads successive lines from a text reader
+  //! 
+  //! \tparam READER - Text reader type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename READER>
+  struct LineRange
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias line_t - Line view type
+    using line_t = StreamView<typename READER::element_t>;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct iterator - Input iterator that reads a line upon each increment
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct iterator : std::iterator<std::input_iterator_tag, line_t>
+    {
+      READER*  Reader;    //!< Reader, or nullptr once exhausted
+      line_t   Line;      //!< Current line
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // iterator::iterator
+      //! Create iterator positioned at the next line, or the end iterator when 'r' is nullptr
+      //! 
+      //! \param[in,out] *r - [optional] Reader
+      /////////////////////////////////////////////////////////////////////////////////////////
+      explicit iterator(READER* r = nullptr) : Reader(r)
+      {
+        ++*this;
+      }
+
+      const line_t& operator*() const   { return Line;  }
+      const line_t* operator->() const  { return &Line; }
+      
+      bool operator==(const iterator& r) const  { return Reader == r.Reader; }
+      bool operator!=(const iterator& r) const  { return Reader != r.Reader; }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // iterator::operator++
+      //! Read the next line
+      //! 
+      //! \return iterator& - Reference to self
+      /////////////////////////////////////////////////////////////////////////////////////////
+      iterator& operator++()
+      {
+        // [EXHAUSTED] Become end iterator
+        if (Reader && !Reader->readLine(Line))
+          Reader = nullptr;
+        return *this;
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    READER&  Reader;    //!< Text reader
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LineRange::LineRange
+    //! Create range upon a text reader
+    //! 
+    //! \param[in,out] &r - Text reader
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit LineRange(READER& r) : Reader(r)
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    iterator begin() const  { return iterator(&Reader); }
+    iterator end() const    { return iterator();         }
   };
 
 
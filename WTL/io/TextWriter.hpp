@@ -10,11 +10,69 @@
 #define WTL_TEXT_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <algorithm>                //!< std::copy
+#include <initializer_list>         //!< std::initializer_list
+#include <string>                   //!< std::char_traits, std::basic_string
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
   
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TextPiece - Immutable reference to a string of known length, for batched writes
+  //! 
+  //! \tparam CHAR - Character type
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHAR>
+  struct TextPiece
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    const CHAR*  Text;       //!< First character
+    uint32_t     Length;     //!< Number of characters
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextPiece::TextPiece
+    //! Create from a string of known length
+    //! 
+    //! \param[in] const* str - String, optionally null terminated
+    //! \param[in] length - Number of characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    TextPiece(const CHAR* str, uint32_t length) : Text(str), Length(length)
+    {}
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextPiece::TextPiece
+    //! Create from a null terminated string
+    //! 
+    //! \param[in] const* str - Null terminated string
+    /////////////////////////////////////////////////////////////////////////////////////////
+    TextPiece(const CHAR* str) : Text(str), Length(static_cast<uint32_t>(std::char_traits<CHAR>::length(str)))
+    {}
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextPiece::TextPiece
+    //! Create from a string literal, without measuring it
+    //! 
+    //! \param[in] const (&)[] str - String literal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    TextPiece(const CHAR (&str)[LENGTH]) : Text(str), Length(str[LENGTH-1] ? LENGTH : LENGTH-1)
+    {}
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextPiece::TextPiece
+    //! Create from a standard string
+    //! 
+    //! \param[in] const& str - String
+    /////////////////////////////////////////////////////////////////////////////////////////
+    TextPiece(const std::basic_string<CHAR>& str) : Text(str.c_str()), Length(static_cast<uint32_t>(str.length()))
+    {}
+  };
+
+
   //////////////////////////////////////////////////////////////////////////////////////////
 	//! \struct TextWriter - Writes formatted text to an output stream
   //! 
@@ -40,6 +98,9 @@ namespace wtl
     //! \typedef position_t - Stream position type
     typedef typename stream_t::position_t position_t;
     
+    //! \typedef piece_t - Batched write argument
+    typedef TextPiece<element_t> piece_t;
+    
     //! \typedef literal_t - Stream element literal
     /*template <unsigned LENGTH>
     using literal_t = const element_t (&)[LENGTH];*/
@@ -96,11 +157,14 @@ namespace wtl
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
-    // TextWriter::str() const
-    //! Get the entire output as a null terminated string
+    // TextWriter::str() 
+    //! Get the entire output as a null terminated string. Writes do not terminate the output, 
+    //! so the terminator is applied here, in place, without advancing the stream. Every write
+    //! reserves space for it.
     //! 
     //! \return const element_t* - Immutable pointer to start of stream
     //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space for terminator
     //! \throw wtl::logic_error - [Debug only] Stream has been closed
     //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -108,9 +172,9 @@ namespace wtl
     {
       CHECKED_LENGTH(1, remaining());
 
-      // Ensure null terminated
-      /*Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);*/
+      // Null terminate using direct stream access
+      *Stream.buffer() = defvalue<element_t>();
+      Stream.release(0);
 
       // Return string
       return Stream.begin();
@@ -140,14 +204,11 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void write(element_t c)
     {
-      CHECKED_LENGTH(2, remaining());
+      // Reserve the terminator applied by str()
+      CHECKED_LENGTH(1 + 1, remaining());
 
       // Write char 
       Stream.put(c);
-
-      // Null terminate
-      Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -161,11 +222,8 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void write(const element_t* str)
     {
-      CHECKED_LENGTH(strlen(str)+1, remaining());
-
-      // Write entire buffer to stream, then reverse over the null terminator
-      Stream.write(str, strlen(str)+1);
-      Stream.seek(-1, FileSeek::Current);
+      // Measure once
+      write(str, static_cast<uint32_t>(std::char_traits<element_t>::length(str)));
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -180,14 +238,39 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void write(const element_t* str, uint32_t length)
     {
-      CHECKED_LENGTH(length, remaining());
+      // Reserve the terminator applied by str()
+      CHECKED_LENGTH(length + 1, remaining());
 
       // Write to stream 
       Stream.write(str, length);
-      
-      // Null terminate then reverse over the null terminator
-      Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // TextWriter::write
+    //! Writes a sequence of strings with a single bounds check and a single stream operation.
+    //! eg. w.write({ "name='", name, "' " });
+    //! 
+    //! \param[in] pieces - Strings to concatenate
+    //! 
+    //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
+    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void write(std::initializer_list<piece_t> pieces)
+    {
+      uint32_t total = 0;
+
+      // Reserve once, including the terminator applied by str()
+      for (const piece_t& p : pieces)
+        total += p.Length;
+      CHECKED_LENGTH(total + 1, remaining());
+
+      // Copy each piece using direct stream access
+      element_t* pos = Stream.buffer();
+      for (const piece_t& p : pieces)
+        pos = std::copy(p.Text, p.Text + p.Length, pos);
+
+      // Release stream
+      Stream.release(total);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -232,10 +315,8 @@ namespace wtl
     template <unsigned LENGTH>
     void write(const element_t (&str)[LENGTH])
     {
-      CHECKED_LENGTH(LENGTH, remaining());
-
-      // Write to stream
-      Stream.write(str);
+      // Write to stream, excluding any null terminator
+      write(str, str[LENGTH-1] ? LENGTH : LENGTH-1);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,378 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\VarInt.hpp
+//! \brief Provides compact LEB128 variable-length integer encoding for binary streams
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_VAR_INT_HPP
+#define WTL_VAR_INT_HPP
+
+#include <wtl/WTL.hpp>
+#include <type_traits>                //!< std::make_unsigned, std::is_signed
+#include <cstring>                    //!< std::memcpy
+#include <wtl/utils/ByteSearch.hpp>   //!< lowest_bit, WTL_SSE2
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \var VarIntMaxLength - Maximum length of an encoded 64-bit integer (in bytes)
+  static constexpr uint32_t VarIntMaxLength = 10;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::zigzag_encode
+  //! Maps a signed integer onto an unsigned integer so that values of small magnitude produce short encodings
+  //!
+  //! \param[in] value - Signed value
+  //! \return uint64_t - Zigzag encoded value  (0,-1,1,-2,2 => 0,1,2,3,4)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint64_t zigzag_encode(int64_t value) noexcept
+  {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::zigzag_decode
+  //! Reverses the zigzag mapping of a signed integer
+  //!
+  //! \param[in] value - Zigzag encoded value
+  //! \return int64_t - Signed value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr int64_t zigzag_decode(uint64_t value) noexcept
+  {
+    return static_cast<int64_t>((value >> 1) ^ (0ULL - (value & 1ULL)));
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::to_varint
+  //! Converts an unsigned integral, boolean, or enumeration value to its varint representation
+  //!
+  //! \tparam T - Unsigned integral type
+  //!
+  //! \param[in] value - Value
+  //! \return uint64_t - Value to encode
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  constexpr std::enable_if_t<std::is_unsigned<T>::value, uint64_t>  to_varint(T value) noexcept
+  {
+    return static_cast<uint64_t>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::to_varint
+  //! Converts a signed integral value to its (zigzag) varint representation
+  //!
+  //! \tparam T - Signed integral type
+  //!
+  //! \param[in] value - Value
+  //! \return uint64_t - Value to encode
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  constexpr std::enable_if_t<std::is_signed<T>::value, uint64_t>  to_varint(T value) noexcept
+  {
+    return zigzag_encode(static_cast<int64_t>(value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::from_varint
+  //! Converts a decoded varint to an unsigned integral value
+  //!
+  //! \tparam T - Unsigned integral type
+  //!
+  //! \param[in] value - Decoded value
+  //! \return T - Value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  constexpr std::enable_if_t<std::is_unsigned<T>::value, T>  from_varint(uint64_t value) noexcept
+  {
+    return static_cast<T>(value);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::from_varint
+  //! Converts a decoded (zigzag) varint to a signed integral value
+  //!
+  //! \tparam T - Signed integral type
+  //!
+  //! \param[in] value - Decoded value
+  //! \return T - Value
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  constexpr std::enable_if_t<std::is_signed<T>::value, T>  from_varint(uint64_t value) noexcept
+  {
+    return static_cast<T>(zigzag_decode(value));
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::varint_length
+  //! Calculates the encoded length of a value
+  //!
+  //! \param[in] value - Value to encode
+  //! \return uint32_t - Number of bytes required (1 to 10)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t varint_length(uint64_t value) noexcept
+  {
+    uint32_t length = 1;
+
+    // Count 7-bit groups beyond the first
+    while (value >= 0x80)
+      value >>= 7, ++length;
+
+    return length;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::varint_encode
+  //! Encodes a value as an LEB128 varint
+  //!
+  //! \param[in] value - Value to encode
+  //! \param[in,out] *output - Output buffer of at least 'VarIntMaxLength' bytes
+  //! \return uint32_t - Number of bytes written
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t varint_encode(uint64_t value, byte* output) noexcept
+  {
+    byte* pos = output;
+
+    // Emit 7 bits per byte with continuation flag
+    while (value >= 0x80)
+    {
+      *pos++ = static_cast<byte>(value | 0x80);
+      value >>= 7;
+    }
+    *pos++ = static_cast<byte>(value);
+
+    return static_cast<uint32_t>(pos - output);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::varint_decode
+  //! Decodes an LEB128 varint.
+  //!
+  //! \remarks When at least 8 bytes are addressable, values up to 56 bits are decoded without branching on
+  //! \remarks  each byte: the terminator is located with a single mask and the 7-bit groups are compacted in parallel.
+  //!
+  //! \param[in] const* input - Encoded bytes
+  //! \param[in] const* end - Position immediately beyond last addressable byte
+  //! \param[in,out] &value - Decoded value
+  //! \return uint32_t - Number of bytes consumed, or zero if the input is truncated or malformed
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t varint_decode(const byte* input, const byte* end, uint64_t& value) noexcept
+  {
+    // [FAST] Decode up to 8 bytes at once
+    if (end - input >= 8)
+    {
+      uint64_t word;
+      std::memcpy(&word, input, sizeof(word));
+
+      // Locate terminating bytes (continuation bit clear)
+      if (uint64_t stops = ~word & 0x8080808080808080ULL)
+      {
+        // Retain all bytes up to and including the first terminator
+        uint64_t bits = word & (stops ^ (stops - 1)) & 0x7f7f7f7f7f7f7f7fULL;
+
+        // Compact 7-bit groups: 8x7 => 4x14 => 2x28 => 1x56
+        bits = (bits & 0x007f007f007f007fULL) | ((bits & 0x7f007f007f007f00ULL) >> 1);
+        bits = (bits & 0x00003fff00003fffULL) | ((bits & 0x3fff00003fff0000ULL) >> 2);
+        bits = (bits & 0x000000000fffffffULL) | ((bits & 0x0fffffff00000000ULL) >> 4);
+
+        value = bits;
+        return (lowest_bit(stops) >> 3) + 1;
+      }
+    }
+
+    // [SLOW] Decode byte-wise near the end of the buffer, or for values wider than 56 bits
+    uint64_t result = 0;
+    for (uint32_t idx = 0, shift = 0; idx < VarIntMaxLength && input + idx < end; ++idx, shift += 7)
+    {
+      uint64_t group = input[idx] & 0x7f;
+
+      // Reject encodings overflowing 64 bits
+      if (idx == VarIntMaxLength-1 && group > 1)
+        return 0;
+
+      result |= group << shift;
+
+      // [TERMINATOR] Done
+      if ((input[idx] & 0x80) == 0)
+      {
+        value = result;
+        return idx + 1;
+      }
+    }
+
+    // [ERROR] Truncated or overlong
+    return 0;
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::varint_decode_run
+  //! Decodes a run of consecutive varints into an array
+  //!
+  //! \remarks Runs of single-byte encodings (the common case for counters and deltas) are detected 16 bytes
+  //! \remarks  at a time with SSE2 and widened without per-byte branching
+  //!
+  //! \tparam T - Integral element type
+  //!
+  //! \param[in] const* input - Encoded bytes
+  //! \param[in] const* end - Position immediately beyond last addressable byte
+  //! \param[in,out] *output - Output array
+  //! \param[in] count - Number of values to decode
+  //! \return uint32_t - Number of bytes consumed, or zero if the input is truncated or malformed
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  uint32_t varint_decode_run(const byte* input, const byte* end, T* output, uint32_t count) noexcept
+  {
+    const byte* pos = input;
+
+    while (count)
+    {
+#if WTL_SSE2
+      // [SIMD] Widen leading single-byte encodings
+      if (end - pos >= 16)
+      {
+        uint32_t mask  = static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))),
+                 small = mask ? lowest_bit(mask) : 16;
+
+        // Clamp to the number of values remaining
+        if (small > count)
+          small = count;
+
+        for (uint32_t idx = 0; idx < small; ++idx)
+          output[idx] = from_varint<T>(pos[idx]);
+
+        pos += small, output += small, count -= small;
+        if (!count)
+          break;
+      }
+#endif
+      uint64_t value;
+
+      // [SCALAR] Decode next value
+      if (uint32_t length = varint_decode(pos, end, value))
+      {
+        *output++ = from_varint<T>(value);
+        pos += length;
+        --count;
+      }
+      else
+        return 0;
+    }
+
+    return static_cast<uint32_t>(pos - input);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct VarInt - Wrapper requesting an integral value be encoded as a compact varint
+  //!
+  //! \tparam T - Integral or enumeration type (optionally const-qualified)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct VarInt
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = VarInt<T>;
+
+    //! \alias value_t - Define value type
+    using value_t = std::remove_const_t<T>;
+
+    static_assert(std::is_integral<value_t>::value || std::is_enum<value_t>::value, "Varints must be integral or enumeration types");
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    T&  Value;    //!< Value reference
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // VarInt::VarInt
+    //! Create wrapper
+    //!
+    //! \param[in] &value - Value
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit VarInt(T& value) : Value(value)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    ENABLE_COPY_CTOR(VarInt);       //!< Can be shallow copied
+    ENABLE_MOVE_CTOR(VarInt);       //!< Can be moved
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::varint
+  //! Object generator for encoding or decoding a value as a compact varint
+  //!
+  //! \tparam T - Integral or enumeration type
+  //!
+  //! \param[in] &value - Value
+  //! \return VarInt<T> - Varint wrapper
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  VarInt<T>  varint(T& value)
+  {
+    return VarInt<T>(value);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DeltaEncoded - Wrapper requesting a sorted integer sequence be encoded as varint deltas
+  //!
+  //! \tparam CONTAINER - Container type (optionally const-qualified)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CONTAINER>
+  struct DeltaEncoded
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DeltaEncoded<CONTAINER>;
+
+    //! \alias value_t - Define element type
+    using value_t = typename std::remove_const_t<CONTAINER>::value_type;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    CONTAINER&  Elements;    //!< Container reference
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeltaEncoded::DeltaEncoded
+    //! Create wrapper
+    //!
+    //! \param[in] &elements - Container of sorted elements
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit DeltaEncoded(CONTAINER& elements) : Elements(elements)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+
+    ENABLE_COPY_CTOR(DeltaEncoded);       //!< Can be shallow copied
+    ENABLE_MOVE_CTOR(DeltaEncoded);       //!< Can be moved
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::delta_encoded
+  //! Object generator for encoding or decoding a sorted integer sequence as a count followed by varint deltas
+  //!
+  //! \tparam CONTAINER - Container type
+  //!
+  //! \param[in] &elements - Container of sorted elements
+  //! \return DeltaEncoded<CONTAINER> - Delta encoding wrapper
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CONTAINER>
+  DeltaEncoded<CONTAINER>  delta_encoded(CONTAINER& elements)
+  {
+    return DeltaEncoded<CONTAINER>(elements);
+  }
+
+} //namespace wtl
+#endif // WTL_VAR_INT_HPP
@@ -0,0 +1,259 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\XPathCache.hpp
+//! \brief Provides a thread-safe cache of compiled XPath queries
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_XPATH_CACHE_HPP
+#define WTL_XPATH_CACHE_HPP
+
+#include <wtl/WTL.hpp>
+#include "pugixml/pugixml.hpp"                //!< pugixml
+#include <algorithm>                          //!< std::max
+#include <atomic>                             //!< std::atomic
+#include <list>                               //!< std::list
+#include <memory>                             //!< std::shared_ptr
+#include <mutex>                              //!< std::mutex
+#include <string>                             //!< std::string
+#include <unordered_map>                      //!< std::unordered_map
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct XPathCache - Bounded cache of compiled XPath queries, keyed by query text
+  //!
+  //! \remarks Compiling a query lexes and parses it into an allocated syntax tree, which dominates the cost of
+  //! \remarks  evaluating a short query against a small document. Once full, the least recently used query is
+  //! \remarks  discarded. Queries registered with 'compile' are pinned: they are never discarded and do not count
+  //! \remarks  towards the capacity.
+  //! \remarks
+  //! \remarks Lookups are thread-safe. Handles keep their query alive after it is discarded, and evaluating a
+  //! \remarks  handle involves neither a lookup nor an allocation for the query itself.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct XPathCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = XPathCache;
+
+    //! \alias handle_t - Compiled query, which may be evaluated concurrently
+    using handle_t = std::shared_ptr<const pugi::xpath_query>;
+
+    //! \var DefaultCapacity - Default maximum number of unpinned queries
+    static constexpr uint32_t DefaultCapacity = 256;
+
+  protected:
+    //! \alias recent_t - Keys of unpinned queries, most recently used first
+    using recent_t = std::list<const std::string*>;
+
+    //! \struct Entry - Cached query
+    struct Entry
+    {
+      handle_t            Query;        //!< Compiled query
+      recent_t::iterator  Position;     //!< Position within 'Recent'  (Unused if pinned)
+      bool                Pinned;       //!< Whether query was registered, and cannot be discarded
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                     Mutex;        //!< Guards 'Cache' and 'Recent'
+    std::unordered_map<std::string,Entry>  Cache;        //!< Queries by text
+    recent_t                               Recent;       //!< Unpinned queries in order of use
+    uint32_t                               Capacity;     //!< Maximum number of unpinned queries
+    std::atomic<uint64_t>                  Hits,         //!< Number of lookups answered from cache
+                                           Misses;       //!< Number of lookups that compiled a query
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::XPathCache
+    //! Create empty cache
+    //!
+    //! \param[in] capacity - [optional] Maximum number of unpinned queries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    XPathCache(uint32_t capacity = DefaultCapacity) : Capacity(std::max<uint32_t>(capacity, 1)), Hits(0), Misses(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(XPathCache);     //!< Cannot be copied
+    DISABLE_MOVE(XPathCache);     //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::shared
+    //! Get the process-wide cache
+    //!
+    //! \return XPathCache& - Cache with default capacity
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static XPathCache& shared()
+    {
+      static XPathCache cache;
+      return cache;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::hits const
+    //! Get the number of lookups answered from the cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t hits() const
+    {
+      return Hits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::misses const
+    //! Get the number of lookups that compiled a query
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t misses() const
+    {
+      return Misses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::size const
+    //! Get the number of cached queries, including pinned queries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      return Cache.size();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::clear
+    //! Discards every unpinned query
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+
+      for (const std::string* key : Recent)
+        Cache.erase(*key);
+      Recent.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::compile
+    //! Registers a query for the lifetime of the cache, typically during startup
+    //!
+    //! \param[in] const* query - XPath 1.0 query
+    //! \return handle_t - Compiled query
+    //!
+    //! \throw pugi::xpath_exception - Invalid query
+    /////////////////////////////////////////////////////////////////////////////////////////
+    handle_t compile(const char* query)
+    {
+      return lookup(query, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::find
+    //! Get a compiled query, compiling and caching it if necessary
+    //!
+    //! \param[in] const* query - XPath 1.0 query
+    //! \return handle_t - Compiled query
+    //!
+    //! \throw pugi::xpath_exception - Invalid query
+    /////////////////////////////////////////////////////////////////////////////////////////
+    handle_t find(const char* query)
+    {
+      return lookup(query, false);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::lookup
+    //! Get a compiled query, compiling and caching it if necessary
+    //!
+    //! \param[in] const* query - XPath 1.0 query
+    //! \param[in] pin - Whether to pin the query
+    //! \return handle_t - Compiled query
+    //!
+    //! \throw pugi::xpath_exception - Invalid query
+    //!
+    //! \remarks Queries are compiled outside the lock; concurrent misses for the same query may each compile it
+    /////////////////////////////////////////////////////////////////////////////////////////
+    handle_t lookup(const char* query, bool pin)
+    {
+      const std::string key(query);
+
+      // [HIT] Mark as most recently used
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        auto entry = Cache.find(key);
+        if (entry != Cache.end())
+        {
+          ++Hits;
+          touch(entry->second, pin);
+          return entry->second.Query;
+        }
+      }
+
+      // [MISS] Compile query, without caching any that are invalid
+      ++Misses;
+      handle_t compiled = std::make_shared<pugi::xpath_query>(query);
+      if (!*compiled)
+        return compiled;
+
+      std::lock_guard<std::mutex> lock(Mutex);
+      auto inserted = Cache.emplace(key, Entry { compiled, Recent.end(), true });
+      Entry& entry = inserted.first->second;
+
+      // [RACE] Prefer query compiled by another thread
+      if (!inserted.second)
+      {
+        touch(entry, pin);
+        return entry.Query;
+      }
+
+      // [UNPINNED] Track usage, discarding the least recently used query when full
+      if (!pin)
+      {
+        entry.Pinned = false;
+        entry.Position = Recent.insert(Recent.begin(), &inserted.first->first);
+
+        if (Recent.size() > Capacity)
+        {
+          Cache.erase(*Recent.back());
+          Recent.pop_back();
+        }
+      }
+      return compiled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XPathCache::touch
+    //! Marks a cached query as most recently used, or pins it  (Caller must hold 'Mutex')
+    //!
+    //! \param[in,out] &entry - Cached query
+    //! \param[in] pin - Whether to pin the query
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void touch(Entry& entry, bool pin)
+    {
+      if (entry.Pinned)
+        return;
+
+      if (pin)
+      {
+        Recent.erase(entry.Position);
+        entry.Position = Recent.end();
+        entry.Pinned = true;
+      }
+      else
+        Recent.splice(Recent.begin(), Recent, entry.Position);
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_XPATH_CACHE_HPP
@@ -0,0 +1,816 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\XmlPullReader.hpp
+//! \brief Provides a streaming XML reader whose memory use is independent of document size
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_XML_PULL_READER_HPP
+#define WTL_XML_PULL_READER_HPP
+
+#include <wtl/WTL.hpp>
+#include "pugixml/pugixml.hpp"                //!< pugixml
+#include <algorithm>                          //!< std::min
+#include <cstring>                            //!< std::memchr, std::memcmp, std::memcpy
+#include <string>                             //!< std::string
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! \enum XmlEvent - Defines the events produced by an XmlPullReader
+  enum class XmlEvent : uint8_t
+  {
+    None,             //!< No event has been read
+    StartElement,     //!< Start tag  (Name and attributes available)
+    Text,             //!< Character data or CDATA section  (Entity references decoded)
+    EndElement,       //!< End tag, or the end of an empty-element tag  (Name available)
+    EndDocument,      //!< Stream has ended
+  };
+
+  //! \struct XmlAttribute - Attribute of a start tag
+  struct XmlAttribute
+  {
+    std::string  Name;      //!< Qualified name
+    std::string  Value;     //!< Value  (Entity references decoded)
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct XmlPullReader - Non-validating streaming XML reader
+  //!
+  //! \tparam STREAM - Input stream type  (A stream whose 'remaining' is zero is considered to have ended)
+  //!
+  //! \remarks Events are pulled one at a time with 'next'. Input is consumed through a window that only needs to
+  //! \remarks  hold the current token, so memory use is bounded by the longest tag or text run rather than the
+  //! \remarks  document (tokens longer than the limit throw). 'skip' passes over a whole element without decoding
+  //! \remarks  its contents, and 'materialize' loads a single element into a pugixml DOM for XPath queries.
+  //! \remarks
+  //! \remarks Input is assumed to be UTF-8. Comments, processing instructions and document type declarations are
+  //! \remarks  skipped, and text consisting only of whitespace is dropped.
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  struct XmlPullReader
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = XmlPullReader<STREAM>;
+
+    //! \alias stream_t - Stream type
+    using stream_t = STREAM;
+
+    //! \var WindowLength - Initial length of input window
+    static constexpr uint32_t WindowLength = 64 * 1024;
+
+    //! \var MaxTokenLength - Default maximum length of a single tag or text run
+    static constexpr uint32_t MaxTokenLength = 16 * 1024 * 1024;
+
+  protected:
+    //! \var npos - Sentinel offset
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //! \enum Markup - Defines the kinds of markup beginning with '<'
+    enum class Markup { StartTag, EndTag, Comment, CData, Instruction, Declaration };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    stream_t                   Stream;          //!< Input stream
+    std::vector<char>          Window;          //!< Unconsumed input
+    size_t                     Begin,           //!< Offset of first unconsumed byte within 'Window'
+                               End;             //!< Offset of last unconsumed byte within 'Window'
+    bool                       Ended;           //!< Whether stream has ended
+    uint32_t                   MaxToken;        //!< Maximum token length
+
+    XmlEvent                   Event;           //!< Current event
+    std::vector<std::string>   Open;            //!< Names of open elements, innermost last
+    std::vector<XmlAttribute>  Attributes;      //!< Attributes of current start tag  (Only 'Count' are valid)
+    uint32_t                   Count;           //!< Number of attributes of current start tag
+    std::string                Text,            //!< Current character data
+                               StartTag;        //!< Markup of current start tag
+    bool                       SelfClosing,     //!< Whether current start tag is an empty-element tag
+                               Closed;          //!< Whether current end tag is yet to be popped from 'Open'
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::XmlPullReader
+    //! Create a reader positioned before the first event
+    //!
+    //! \tparam ARGS... - Stream constructor argument types
+    //!
+    //! \param[in,out] &&... args - Stream constructor arguments
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS> explicit
+    XmlPullReader(ARGS&&... args) : Stream(std::forward<ARGS>(args)...),
+                                    Window(WindowLength),
+                                    Begin(0),
+                                    End(0),
+                                    Ended(false),
+                                    MaxToken(MaxTokenLength),
+                                    Event(XmlEvent::None),
+                                    Count(0),
+                                    SelfClosing(false),
+                                    Closed(false)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(XmlPullReader);      //!< Cannot be copied
+    ENABLE_MOVE(XmlPullReader);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::attribute const
+    //! Get an attribute of the current start tag
+    //!
+    //! \param[in] idx - Zero-based index
+    //! \return const XmlAttribute& - Attribute
+    //!
+    //! \throw wtl::out_of_range - Index exceeds number of attributes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const XmlAttribute& attribute(uint32_t idx) const
+    {
+      if (idx >= Count)
+        throw wtl::out_of_range(HERE, "Attribute ", idx, " exceeds ", Count, " attributes");
+
+      return Attributes[idx];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::attribute const
+    //! Find an attribute of the current start tag by name
+    //!
+    //! \param[in] const* name - Qualified name
+    //! \return const char* - Value, or nullptr if absent
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const char* attribute(const char* name) const
+    {
+      for (uint32_t idx = 0; idx < Count; ++idx)
+        if (Attributes[idx].Name == name)
+          return Attributes[idx].Value.c_str();
+
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::attributes const
+    //! Get the number of attributes of the current start tag
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t attributes() const
+    {
+      return Event == XmlEvent::StartElement ? Count : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::depth const
+    //! Get the number of open elements, including the element of the current start or end tag
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t depth() const
+    {
+      return static_cast<uint32_t>(Open.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::event const
+    //! Get the current event
+    /////////////////////////////////////////////////////////////////////////////////////////
+    XmlEvent event() const
+    {
+      return Event;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::name const
+    //! Get the name of the element of the current start or end tag
+    //!
+    //! \throw wtl::logic_error - Current event is neither a start nor an end tag
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const std::string& name() const
+    {
+      if (Event != XmlEvent::StartElement && Event != XmlEvent::EndElement)
+        throw wtl::logic_error(HERE, "Current event has no name");
+
+      return Open.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::text const
+    //! Get the character data of the current text event
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const std::string& text() const
+    {
+      return Text;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::limit
+    //! Sets the maximum length of a single tag or text run, which bounds the input window
+    //!
+    //! \param[in] maxTokenLength - Maximum token length, in bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void limit(uint32_t maxTokenLength)
+    {
+      MaxToken = std::max<uint32_t>(maxTokenLength, 16);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::materialize
+    //! Loads the element of the current start tag, including its descendants, into a DOM and positions the
+    //! reader upon its end tag
+    //!
+    //! \param[in,out] &doc - Document receiving the element
+    //! \return pugi::xml_node - Element
+    //!
+    //! \throw wtl::logic_error - Current event is not a start tag
+    //! \throw wtl::domain_error - Malformed document
+    //! \throw wtl::length_error - Token exceeds maximum length
+    /////////////////////////////////////////////////////////////////////////////////////////
+    pugi::xml_node materialize(pugi::xml_document& doc)
+    {
+      std::string markup;
+      subtree(&markup);
+
+      // Parse markup of element alone
+      pugi::xml_parse_result res = doc.load_buffer(markup.data(), markup.size(), pugi::parse_default);
+      if (!res)
+        throw wtl::domain_error(HERE, "Unable to parse xml: ", res.description());
+
+      return doc.first_child();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::next
+    //! Reads the next event
+    //!
+    //! \return XmlEvent - Event
+    //!
+    //! \throw wtl::domain_error - Malformed document
+    //! \throw wtl::length_error - Token exceeds maximum length
+    /////////////////////////////////////////////////////////////////////////////////////////
+    XmlEvent next()
+    {
+      // Pop element of previous end tag
+      if (Closed)
+      {
+        Open.pop_back();
+        Closed = false;
+      }
+
+      // [EMPTY-ELEMENT] Report end of element
+      if (SelfClosing)
+      {
+        SelfClosing = false;
+        Closed = true;
+        return Event = XmlEvent::EndElement;
+      }
+
+      for (;;)
+      {
+        // [END] Verify every element was closed
+        if (!available(1))
+        {
+          if (!Open.empty())
+            throw wtl::domain_error(HERE, "Unexpected end of document within element '", Open.back(), "'");
+
+          return Event = XmlEvent::EndDocument;
+        }
+
+        // [TEXT] Read up to next markup, dropping whitespace
+        if (at(0) != '<')
+        {
+          size_t length = find('<', 0);
+          if (length == npos)
+            length = End - Begin;
+
+          const char* text = Window.data() + Begin;
+          const bool blank = std::all_of(text, text + length, [] (char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; });
+          if (!blank)
+            decode(text, length, Text);
+          consume(length);
+
+          if (blank)
+            continue;
+          return Event = XmlEvent::Text;
+        }
+
+        size_t length, last;
+        switch (classify())
+        {
+        // [START] Parse name and attributes
+        case Markup::StartTag:
+          if ((last = tagEnd(1)) == npos)
+            throw wtl::domain_error(HERE, "Unterminated start tag");
+
+          StartTag.assign(Window.data() + Begin, last + 1);
+          consume(last + 1);
+          parseStartTag();
+          return Event = XmlEvent::StartElement;
+
+        // [END] Verify name matches the innermost open element
+        case Markup::EndTag:
+          if ((last = find('>', 2)) == npos)
+            throw wtl::domain_error(HERE, "Unterminated end tag");
+
+          verifyEndTag(Window.data() + Begin + 2, Window.data() + Begin + last);
+          consume(last + 1);
+          Closed = true;
+          return Event = XmlEvent::EndElement;
+
+        // [CDATA] Report verbatim
+        case Markup::CData:
+          if ((length = findSequence("]]>", 9)) == npos)
+            throw wtl::domain_error(HERE, "Unterminated CDATA section");
+
+          Text.assign(Window.data() + Begin + 9, length - 9);
+          consume(length + 3);
+          return Event = XmlEvent::Text;
+
+        // [OTHER] Skip
+        default:
+          skipMarkup();
+          continue;
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::skip
+    //! Skips the descendants of the element of the current start tag and positions the reader upon its end tag
+    //!
+    //! \throw wtl::logic_error - Current event is not a start tag
+    //! \throw wtl::domain_error - Malformed document
+    //!
+    //! \remarks Tags within the element are located but not parsed, and its text is never decoded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void skip()
+    {
+      subtree(nullptr);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::at const
+    //! Get an unconsumed byte
+    //!
+    //! \param[in] idx - Offset from first unconsumed byte
+    /////////////////////////////////////////////////////////////////////////////////////////
+    char at(size_t idx) const
+    {
+      return Window[Begin + idx];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::available
+    //! Ensures a number of unconsumed bytes are within the window
+    //!
+    //! \param[in] n - Number of bytes
+    //! \return bool - False if the stream ended first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool available(size_t n)
+    {
+      while (End - Begin < n)
+        if (!fill())
+          return false;
+
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::classify
+    //! Identifies the markup at the first unconsumed byte, which must be '<'
+    //!
+    //! \throw wtl::domain_error - Truncated markup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Markup classify()
+    {
+      if (!available(2))
+        throw wtl::domain_error(HERE, "Unexpected end of document within markup");
+
+      switch (at(1))
+      {
+      case '/': return Markup::EndTag;
+      case '?': return Markup::Instruction;
+      case '!':
+        if (starts("<!--"))
+          return Markup::Comment;
+        if (starts("<![CDATA["))
+          return Markup::CData;
+        return Markup::Declaration;
+      }
+      return Markup::StartTag;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::consume
+    //! Consumes bytes from the window
+    //!
+    //! \param[in] n - Number of bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void consume(size_t n)
+    {
+      Begin += n;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::decode
+    //! Decodes character data, replacing entity and character references
+    //!
+    //! \param[in] const* text - Character data
+    //! \param[in] length - Length of character data
+    //! \param[in,out] &out - Receives decoded text
+    //!
+    //! \throw wtl::domain_error - Malformed or unknown reference
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void decode(const char* text, size_t length, std::string& out)
+    {
+      const char* const end = text + length;
+      out.clear();
+
+      for (const char* amp; (amp = static_cast<const char*>(std::memchr(text, '&', end - text))) != nullptr; )
+      {
+        out.append(text, amp);
+
+        const char* semi = static_cast<const char*>(std::memchr(amp, ';', std::min<ptrdiff_t>(end - amp, 12)));
+        if (!semi)
+          throw wtl::domain_error(HERE, "Unterminated entity reference");
+
+        const std::string ref(amp + 1, semi);
+        if (ref == "lt")        out += '<';
+        else if (ref == "gt")   out += '>';
+        else if (ref == "amp")  out += '&';
+        else if (ref == "quot") out += '"';
+        else if (ref == "apos") out += '\'';
+        else if (ref.size() > 1 && ref[0] == '#')
+        {
+          char* last = nullptr;
+          const unsigned long cp = ref[1] == 'x' ? std::strtoul(ref.c_str() + 2, &last, 16) : std::strtoul(ref.c_str() + 1, &last, 10);
+          if (*last || cp > 0x10FFFF)
+            throw wtl::domain_error(HERE, "Invalid character reference '&", ref, ";'");
+          utf8(static_cast<uint32_t>(cp), out);
+        }
+        else
+          throw wtl::domain_error(HERE, "Unknown entity reference '&", ref, ";'");
+
+        text = semi + 1;
+      }
+      out.append(text, end);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::fill
+    //! Appends input to the window, compacting or growing it as necessary
+    //!
+    //! \return bool - False if the stream has ended
+    //!
+    //! \throw wtl::length_error - Token exceeds maximum length
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool fill()
+    {
+      if (Ended)
+        return false;
+
+      if (End - Begin >= MaxToken)
+        throw wtl::length_error(HERE, "XML token exceeds maximum length of ", MaxToken, " bytes");
+
+      // Discard consumed bytes
+      if (Begin && (End == Window.size() || Begin >= Window.size() / 2))
+      {
+        std::memmove(Window.data(), Window.data() + Begin, End - Begin);
+        End -= Begin;
+        Begin = 0;
+      }
+
+      // [FULL] Grow window to accommodate a long token
+      if (End == Window.size())
+        Window.resize(std::min<size_t>(Window.size() * 2, MaxToken));
+
+      const size_t n = std::min<size_t>(Stream.remaining(), Window.size() - End);
+      if (!n)
+        return !(Ended = true);
+
+      std::memcpy(Window.data() + End, Stream.buffer(), n);
+      Stream.release(static_cast<uint32_t>(n));
+      End += n;
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::find
+    //! Finds the next occurrence of a character
+    //!
+    //! \param[in] ch - Character
+    //! \param[in] from - Offset from first unconsumed byte at which to begin searching
+    //! \return size_t - Offset from first unconsumed byte, or npos if the stream ended first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t find(char ch, size_t from)
+    {
+      for (size_t idx = from; ; )
+      {
+        if (idx < End - Begin)
+        {
+          if (const void* pos = std::memchr(Window.data() + Begin + idx, ch, End - Begin - idx))
+            return static_cast<const char*>(pos) - (Window.data() + Begin);
+          idx = End - Begin;
+        }
+
+        if (!fill())
+          return npos;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::findSequence
+    //! Finds the next occurrence of a sequence of characters
+    //!
+    //! \param[in] const* seq - Sequence
+    //! \param[in] from - Offset from first unconsumed byte at which to begin searching
+    //! \return size_t - Offset from first unconsumed byte, or npos if the stream ended first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t findSequence(const char* seq, size_t from)
+    {
+      const size_t length = std::strlen(seq);
+
+      for (size_t idx = from; (idx = find(seq[0], idx)) != npos; ++idx)
+      {
+        if (!available(idx + length))
+          return npos;
+        if (std::memcmp(Window.data() + Begin + idx, seq, length) == 0)
+          return idx;
+      }
+      return npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::markupEnd
+    //! Finds the last byte of a comment, CDATA section, processing instruction or declaration
+    //!
+    //! \param[in] kind - Kind of markup at the first unconsumed byte
+    //! \return size_t - Offset of last byte, or npos if the stream ended first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t markupEnd(Markup kind)
+    {
+      size_t pos;
+      switch (kind)
+      {
+      case Markup::Comment:     return (pos = findSequence("-->", 4)) != npos ? pos + 2 : npos;
+      case Markup::CData:       return (pos = findSequence("]]>", 9)) != npos ? pos + 2 : npos;
+      case Markup::Instruction: return (pos = findSequence("?>", 2)) != npos ? pos + 1 : npos;
+      case Markup::EndTag:      return find('>', 2);
+      case Markup::StartTag:    return tagEnd(1);
+      case Markup::Declaration: break;
+      }
+
+      // Skip internal subset of document type declarations
+      int32_t nesting = 0;
+      for (size_t idx = 2; ; ++idx)
+      {
+        if (!available(idx + 1))
+          return npos;
+
+        switch (at(idx))
+        {
+        case '[': ++nesting; break;
+        case ']': --nesting; break;
+        case '>':
+          if (nesting <= 0)
+            return idx;
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::parseStartTag
+    //! Parses the name and attributes of the current start tag
+    //!
+    //! \throw wtl::domain_error - Malformed tag
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void parseStartTag()
+    {
+      const auto space = [] (char ch) { return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n'; };
+      const char *pos = StartTag.data() + 1,
+                 *end = StartTag.data() + StartTag.size() - 1;
+
+      // Detect empty-element tag
+      if ((SelfClosing = end[-1] == '/'))
+        --end;
+
+      // Read name
+      const char* name = pos;
+      while (pos != end && !space(*pos))
+        ++pos;
+      if (pos == name)
+        throw wtl::domain_error(HERE, "Start tag has no name");
+      Open.emplace_back(name, pos);
+
+      // Read attributes
+      for (Count = 0; ; ++Count)
+      {
+        while (pos != end && space(*pos))
+          ++pos;
+        if (pos == end)
+          break;
+
+        const char* attr = pos;
+        while (pos != end && *pos != '=' && !space(*pos))
+          ++pos;
+        const char* attrEnd = pos;
+        while (pos != end && space(*pos))
+          ++pos;
+
+        if (pos == end || *pos != '=' || attr == attrEnd)
+          throw wtl::domain_error(HERE, "Malformed attribute in start tag '", Open.back(), "'");
+
+        do
+          ++pos;
+        while (pos != end && space(*pos));
+
+        const char quote = pos != end ? *pos : '\0';
+        const char* value = pos + 1;
+        if ((quote != '"' && quote != '\'') || (pos = static_cast<const char*>(std::memchr(value, quote, end - value))) == nullptr)
+          throw wtl::domain_error(HERE, "Malformed attribute value in start tag '", Open.back(), "'");
+
+        // Reuse attribute storage
+        if (Count == Attributes.size())
+          Attributes.emplace_back();
+        Attributes[Count].Name.assign(attr, attrEnd);
+        decode(value, pos - value, Attributes[Count].Value);
+        ++pos;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::skipMarkup
+    //! Consumes a comment, processing instruction or declaration
+    //!
+    //! \throw wtl::domain_error - Unterminated markup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void skipMarkup()
+    {
+      const size_t last = markupEnd(classify());
+      if (last == npos)
+        throw wtl::domain_error(HERE, "Unterminated markup");
+
+      consume(last + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::starts
+    //! Query whether the unconsumed bytes begin with a sequence
+    //!
+    //! \param[in] const* seq - Sequence
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool starts(const char* seq)
+    {
+      const size_t length = std::strlen(seq);
+      return available(length) && std::memcmp(Window.data() + Begin, seq, length) == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::subtree
+    //! Consumes the remainder of the element of the current start tag
+    //!
+    //! \param[in,out] *markup - [optional] Receives the markup of the element, including its start tag
+    //!
+    //! \throw wtl::logic_error - Current event is not a start tag
+    //! \throw wtl::domain_error - Malformed document
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void subtree(std::string* markup)
+    {
+      if (Event != XmlEvent::StartElement)
+        throw wtl::logic_error(HERE, "Current event is not a start tag");
+
+      if (markup)
+        markup->assign(StartTag);
+
+      // [EMPTY-ELEMENT] Already complete
+      if (SelfClosing)
+      {
+        SelfClosing = false;
+        Closed = true;
+        Event = XmlEvent::EndElement;
+        return;
+      }
+
+      for (uint32_t nesting = 1; ; )
+      {
+        // Pass over text in window-sized pieces, without decoding
+        const void* lt = std::memchr(Window.data() + Begin, '<', End - Begin);
+        const size_t text = lt ? static_cast<const char*>(lt) - (Window.data() + Begin) : End - Begin;
+        if (markup)
+          markup->append(Window.data() + Begin, text);
+        consume(text);
+
+        if (!lt)
+        {
+          if (!fill())
+            throw wtl::domain_error(HERE, "Unexpected end of document within element '", Open.back(), "'");
+          continue;
+        }
+
+        // Locate end of markup, tracking nesting of elements
+        const Markup kind = classify();
+        const size_t last = markupEnd(kind);
+        if (last == npos)
+          throw wtl::domain_error(HERE, "Unterminated markup within element '", Open.back(), "'");
+
+        const bool opens = kind == Markup::StartTag && at(last - 1) != '/',
+                   closes = kind == Markup::EndTag;
+
+        if (closes && nesting == 1)
+          verifyEndTag(Window.data() + Begin + 2, Window.data() + Begin + last);
+
+        if (markup)
+          markup->append(Window.data() + Begin, last + 1);
+        consume(last + 1);
+
+        if (opens)
+          ++nesting;
+        else if (closes && --nesting == 0)
+        {
+          Closed = true;
+          Event = XmlEvent::EndElement;
+          return;
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::tagEnd
+    //! Finds the '>' closing a start tag, ignoring any within quoted attribute values
+    //!
+    //! \param[in] from - Offset from first unconsumed byte at which to begin searching
+    //! \return size_t - Offset of '>', or npos if the stream ended first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t tagEnd(size_t from)
+    {
+      char quote = '\0';
+
+      for (size_t idx = from; available(idx + 1); ++idx)
+      {
+        const char ch = at(idx);
+        if (quote)
+          quote = (ch == quote ? '\0' : quote);
+        else if (ch == '"' || ch == '\'')
+          quote = ch;
+        else if (ch == '>')
+          return idx;
+      }
+      return npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::utf8
+    //! Appends a code point encoded as UTF-8
+    //!
+    //! \param[in] cp - Code point
+    //! \param[in,out] &out - Output
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void utf8(uint32_t cp, std::string& out)
+    {
+      if (cp < 0x80)
+        out += static_cast<char>(cp);
+      else if (cp < 0x800)
+      {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      else if (cp < 0x10000)
+      {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      else
+      {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlPullReader::verifyEndTag const
+    //! Verifies an end tag closes the innermost open element
+    //!
+    //! \param[in] const* name - First character after '</'
+    //! \param[in] const* end - Position of closing '>'
+    //!
+    //! \throw wtl::domain_error - Mismatched end tag
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void verifyEndTag(const char* name, const char* end) const
+    {
+      while (end != name && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n'))
+        --end;
+
+      if (Open.empty() || Open.back().compare(0, std::string::npos, name, end - name) != 0)
+        throw wtl::domain_error(HERE, "Mismatched end tag '", std::string(name, end), "'");
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_XML_PULL_READER_HPP
@@ -11,6 +11,7 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/SFINAE.hpp>       //!< enable_if_floating_t
+#include <wtl/io/XPathCache.hpp>      //!< XPathCache
 #include "pugixml/pugixml.hpp"        //!< pugixml
 
 //! \namespace wtl - Windows template library
@@ -20,6 +21,11 @@ namespace wtl
 	//! \struct XmlReader - Non-validating DOM XML reader. This class is now out of date and needs updating.
   //!
   //! \tparam STREAM - Stream type
+  //!
+  //! \remarks Loads the entire document into memory; use XmlPullReader for documents larger than memory
+  //! \remarks
+  //! \remarks Queries passed as text are compiled once and cached by every reader; queries evaluated in loops
+  //! \remarks  can instead be compiled at startup, and the handle evaluated directly.
   //////////////////////////////////////////////////////////////////////////////////////////
   template <typename STREAM>
   struct XmlReader 
@@ -35,6 +41,9 @@ namespace wtl
     //! \typedef XPathQuery - XPath query
     typedef pugi::xpath_query  XPathQuery;
     
+    //! \typedef XPathHandle - Compiled XPath query
+    typedef XPathCache::handle_t  XPathHandle;
+
     //! \typedef XmlNode - Single DOM query
     typedef pugi::xml_node  XmlNode;
 
@@ -93,10 +102,24 @@ namespace wtl
     //! 
     //! \param[in] const *query - XPath 1.0 query to evaluate
     //! \return XPathNode - Result node
+    //! 
+    //! \throw pugi::xpath_exception - Invalid query
     //////////////////////////////////////////////////////////////////////////////////////////
     XPathNode selectNode(const char* query) const
     {
-      return Document.select_single_node(XPathQuery(query));
+      return Document.select_single_node(*queries().find(query));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlReader::selectNode
+    //! Execute a compiled query that returns a single node
+    //! 
+    //! \param[in] const& query - Compiled query
+    //! \return XPathNode - Result node
+    //////////////////////////////////////////////////////////////////////////////////////////
+    XPathNode selectNode(const XPathHandle& query) const
+    {
+      return Document.select_single_node(*query);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -105,10 +128,24 @@ namespace wtl
     //! 
     //! \param[in] const *query - XPath 1.0 query to evaluate
     //! \return XPathNodeSet - Set of result nodes
+    //! 
+    //! \throw pugi::xpath_exception - Invalid query
     //////////////////////////////////////////////////////////////////////////////////////////
     XPathNodeSet selectNodes(const char* query) const
     {
-      return Document.select_nodes(XPathQuery(query));
+      return Document.select_nodes(*queries().find(query));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // XmlReader::selectNodes
+    //! Execute a compiled query that returns a set of nodes
+    //! 
+    //! \param[in] const& query - Compiled query
+    //! \return XPathNodeSet - Set of result nodes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    XPathNodeSet selectNodes(const XPathHandle& query) const
+    {
+      return Document.select_nodes(*query);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -127,7 +164,7 @@ namespace wtl
     template <Encoding ENCODING, unsigned LENGTH>
     bool getString(const char* query, CharArray<ENCODING,LENGTH>& str) const
     { 
-      return getString(XPathQuery(query), str);
+      return getString(*queries().find(query), str);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -281,6 +318,31 @@ namespace wtl
     
     // ----------------------------------- MUTATOR METHODS ----------------------------------
 
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // XmlReader::compile
+    //! Compiles a query for repeated evaluation, and pins it within the query cache
+    //! 
+    //! \param[in] const *query - XPath 1.0 query
+    //! \return XPathHandle - Compiled query, which may be evaluated concurrently by any reader
+    //! 
+    //! \throw pugi::xpath_exception - Invalid query
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static XPathHandle compile(const char* query)
+    {
+      return queries().compile(query);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // XmlReader::queries
+    //! Get the cache of compiled queries shared by every reader
+    //! 
+    //! \return XPathCache& - Query cache
+    //////////////////////////////////////////////////////////////////////////////////////////
+    static XPathCache& queries()
+    {
+      return XPathCache::shared();
+    }
+
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
     pugi::xml_document Document;      //!< PugiXml DOM Document
@@ -365,7 +365,7 @@ namespace wtl
   //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
   //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM, typename U, enable_if_enum_t<U>>
+  template <typename STREAM, typename U, typename = enable_if_enum_t<U>, typename = void>
   XmlWriter<STREAM>&  operator << (XmlWriter<STREAM>& w, U val)
   {
     // Write as a numeral accoring to underlying type
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\ByteSearch.hpp
+//! \brief Provides vectorized searches for bytes within buffers
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_BYTE_SEARCH_HPP
+#define WTL_BYTE_SEARCH_HPP
+
+#include <wtl/WTL.hpp>
+
+//! \if _M_X64 || _M_IX86 - SSE2 is always available on supported targets
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+  #include <emmintrin.h>              //!< _mm_loadu_si128, _mm_movemask_epi8
+  #define WTL_SSE2  1
+#else
+  #define WTL_SSE2  0
+#endif
+
+//! \if _MSC_VER - Bit scan intrinsics
+#ifdef _MSC_VER
+  #include <intrin.h>                 //!< _BitScanForward, _BitScanForward64
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::lowest_bit
+  //! Queries the index of the least significant set bit
+  //!
+  //! \param[in] mask - Non-zero mask
+  //! \return uint32_t - Zero-based index of least significant set bit
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t lowest_bit(uint64_t mask) noexcept
+  {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, mask);
+    return idx;
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    if (_BitScanForward(&idx, static_cast<unsigned long>(mask)))
+      return idx;
+    _BitScanForward(&idx, static_cast<unsigned long>(mask >> 32));
+    return idx + 32;
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(mask));
+#endif
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::find_byte
+  //! Finds the first occurrence of a byte, examining 16 bytes per iteration where possible
+  //!
+  //! \param[in] const* pos - First byte
+  //! \param[in] const* end - Position beyond last byte
+  //! \param[in] c - Byte to find
+  //! \return const char* - Position of first occurrence, otherwise 'end'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline const char* find_byte(const char* pos, const char* end, char c) noexcept
+  {
+#if WTL_SSE2
+    const __m128i needle = _mm_set1_epi8(c);
+
+    // Compare blocks of 16 bytes
+    for (; end - pos >= 16; pos += 16)
+      if (int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)), needle)))
+        return pos + lowest_bit(static_cast<uint32_t>(mask));
+#endif
+    // Compare remaining bytes
+    for (; pos != end; ++pos)
+      if (*pos == c)
+        return pos;
+
+    return end;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::find_either
+  //! Finds the first occurrence of either of two bytes, examining 16 bytes per iteration where possible
+  //!
+  //! \param[in] const* pos - First byte
+  //! \param[in] const* end - Position beyond last byte
+  //! \param[in] a - Byte to find
+  //! \param[in] b - Another byte to find
+  //! \return const char* - Position of first occurrence of either byte, otherwise 'end'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline const char* find_either(const char* pos, const char* end, char a, char b) noexcept
+  {
+#if WTL_SSE2
+    const __m128i first = _mm_set1_epi8(a),
+                  second = _mm_set1_epi8(b);
+
+    // Compare blocks of 16 bytes
+    for (; end - pos >= 16; pos += 16)
+    {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+      if (int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, first), _mm_cmpeq_epi8(block, second))))
+        return pos + lowest_bit(static_cast<uint32_t>(mask));
+    }
+#endif
+    // Compare remaining bytes
+    for (; pos != end; ++pos)
+      if (*pos == a || *pos == b)
+        return pos;
+
+    return end;
+  }
+
+} //namespace wtl
+#endif // WTL_BYTE_SEARCH_HPP
@@ -0,0 +1,405 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\Checksum.hpp
+//! \brief Provides CRC32C and 64-bit xxHash checksums
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CHECKSUM_HPP
+#define WTL_CHECKSUM_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                  //!< std::min
+#include <cstring>                    //!< std::memcpy
+#include <utility>                    //!< std::index_sequence
+
+//! \if _M_X64 || _M_IX86 - CRC32 instruction is available on x86 processors supporting SSE4.2
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+  #include <nmmintrin.h>              //!< _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+  #define WTL_CRC32_INSTRUCTION  1
+  #ifdef _MSC_VER
+    #include <intrin.h>               //!< __cpuid
+    #define WTL_TARGET_SSE42
+  #else
+    #include <cpuid.h>                //!< __get_cpuid
+    #define WTL_TARGET_SSE42  __attribute__((target("sse4.2")))
+  #endif
+#else
+  #define WTL_CRC32_INSTRUCTION  0
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Crc32cTable - Lookup tables for slicing-by-8 CRC32C computation
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct Crc32cTable
+  {
+    uint32_t  Values[8][256];     //!< CRC of each byte value followed by 0-7 zero bytes
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::crc32c_shift constexpr
+  //! Shifts bits out of a CRC using the Castagnoli polynomial (reflected)
+  //!
+  //! \param[in] crc - CRC
+  //! \param[in] bits - Number of bits to shift
+  //! \return uint32_t - CRC
+  //////////////////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t crc32c_shift(uint32_t crc, uint32_t bits)
+  {
+    return bits ? crc32c_shift(crc & 1 ? (crc >> 1) ^ 0x82F63B78u : crc >> 1, bits - 1) : crc;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::generate_crc32c_table constexpr
+  //! Generates the slicing-by-8 tables of the Castagnoli polynomial (reflected)
+  //!
+  //! \tparam IDX... - Byte values
+  //!
+  //! \return Crc32cTable - Lookup tables
+  //!
+  //! \remarks Shifting a byte value followed by N zero bytes out of a CRC is equivalent to shifting 8*(N+1) bits
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <size_t... IDX>
+  constexpr Crc32cTable generate_crc32c_table(std::index_sequence<IDX...>)
+  {
+    return Crc32cTable { { { crc32c_shift(IDX,  8)... }, { crc32c_shift(IDX, 16)... },
+                           { crc32c_shift(IDX, 24)... }, { crc32c_shift(IDX, 32)... },
+                           { crc32c_shift(IDX, 40)... }, { crc32c_shift(IDX, 48)... },
+                           { crc32c_shift(IDX, 56)... }, { crc32c_shift(IDX, 64)... } } };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct crc32c_table - Provides the CRC32C lookup tables
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename = void>
+  struct crc32c_table
+  {
+    static constexpr Crc32cTable Table = generate_crc32c_table(std::make_index_sequence<256>());    //!< Slicing-by-8 tables
+  };
+
+  //! \var crc32c_table::Table - Out-of-class definition
+  template <typename T>
+  constexpr Crc32cTable crc32c_table<T>::Table;
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::crc32c_portable
+  //! Updates a CRC32C (without pre/post inversion) eight bytes at a time using lookup tables
+  //!
+  //! \param[in] crc - Inverted CRC
+  //! \param[in] const* pos - Data
+  //! \param[in] length - Length of data, in bytes
+  //! \return uint32_t - Inverted CRC
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t crc32c_portable(uint32_t crc, const byte* pos, size_t length) noexcept
+  {
+    const auto& t = crc32c_table<>::Table.Values;
+
+    for (; length >= 8; pos += 8, length -= 8)
+    {
+      uint32_t lo, hi;
+      std::memcpy(&lo, pos, 4);
+      std::memcpy(&hi, pos + 4, 4);
+      lo ^= crc;
+      crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24]
+          ^ t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+    }
+
+    for (; length; ++pos, --length)
+      crc = (crc >> 8) ^ t[0][(crc ^ *pos) & 0xff];
+
+    return crc;
+  }
+
+#if WTL_CRC32_INSTRUCTION
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::crc32c_hardware
+  //! Updates a CRC32C (without pre/post inversion) using the SSE4.2 CRC32 instruction
+  //!
+  //! \param[in] crc - Inverted CRC
+  //! \param[in] const* pos - Data
+  //! \param[in] length - Length of data, in bytes
+  //! \return uint32_t - Inverted CRC
+  //////////////////////////////////////////////////////////////////////////////////////////
+  WTL_TARGET_SSE42
+  inline uint32_t crc32c_hardware(uint32_t crc, const byte* pos, size_t length) noexcept
+  {
+#if defined(_M_X64) || defined(__x86_64__)
+    uint64_t crc64 = crc;
+    for (; length >= 8; pos += 8, length -= 8)
+    {
+      uint64_t word;
+      std::memcpy(&word, pos, 8);
+      crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+#endif
+    for (; length >= 4; pos += 4, length -= 4)
+    {
+      uint32_t word;
+      std::memcpy(&word, pos, 4);
+      crc = _mm_crc32_u32(crc, word);
+    }
+
+    for (; length; ++pos, --length)
+      crc = _mm_crc32_u8(crc, *pos);
+
+    return crc;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::has_crc32_instruction
+  //! Query whether the processor supports SSE4.2 (once)
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline bool has_crc32_instruction() noexcept
+  {
+    static const bool supported = []
+    {
+#ifdef _MSC_VER
+      int info[4];
+      __cpuid(info, 1);
+      return (info[2] & (1 << 20)) != 0;
+#else
+      unsigned a, b, c, d;
+      return __get_cpuid(1, &a, &b, &c, &d) && (c & bit_SSE4_2) != 0;
+#endif
+    }();
+    return supported;
+  }
+#endif
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::crc32c
+  //! Updates a CRC32C (Castagnoli) checksum, using the CRC32 instruction where available
+  //!
+  //! \param[in] crc - Checksum of preceding data  (Zero initially)
+  //! \param[in] const* data - Data
+  //! \param[in] length - Length of data, in bytes
+  //! \return uint32_t - Checksum of preceding data and 'data'
+  //////////////////////////////////////////////////////////////////////////////////////////
+  inline uint32_t crc32c(uint32_t crc, const void* data, size_t length) noexcept
+  {
+    const byte* pos = static_cast<const byte*>(data);
+#if WTL_CRC32_INSTRUCTION
+    if (has_crc32_instruction())
+      return ~crc32c_hardware(~crc, pos, length);
+#endif
+    return ~crc32c_portable(~crc, pos, length);
+  }
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Crc32c - Incremental CRC32C checksum
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct Crc32c
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias value_type - Checksum type
+    using value_type = uint32_t;
+
+    //! \var Id - Identifies the algorithm within stream headers
+    static constexpr uint32_t Id = 1;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    uint32_t  Value;      //!< Checksum so far
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Crc32c::Crc32c
+    //! Begin a checksum
+    //!
+    //! \param[in] seed - [optional] Initial value  (Low 32 bits)
+    //////////////////////////////////////////////////////////////////////////////////////////
+    explicit Crc32c(uint64_t seed = 0) noexcept : Value(static_cast<uint32_t>(seed))
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Crc32c::value const
+    //! Get the checksum of the data so far
+    //////////////////////////////////////////////////////////////////////////////////////////
+    value_type value() const noexcept
+    {
+      return Value;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Crc32c::update
+    //! Appends data to the checksum
+    //!
+    //! \param[in] const* data - Data
+    //! \param[in] length - Length of data, in bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void update(const void* data, size_t length) noexcept
+    {
+      Value = crc32c(Value, data, length);
+    }
+  };
+
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct XxHash64 - Incremental 64-bit xxHash
+  //////////////////////////////////////////////////////////////////////////////////////////
+  struct XxHash64
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias value_type - Checksum type
+    using value_type = uint64_t;
+
+    //! \var Id - Identifies the algorithm within stream headers
+    static constexpr uint32_t Id = 2;
+
+  private:
+    static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull,
+                              Prime2 = 0xC2B2AE3D27D4EB4Full,
+                              Prime3 = 0x165667B19E3779F9ull,
+                              Prime4 = 0x85EBCA77C2B2AE63ull,
+                              Prime5 = 0x27D4EB2F165667C5ull;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    uint64_t  Seed;           //!< Seed
+    uint64_t  Lanes[4];       //!< Accumulators of each 8-byte lane of every 32-byte stripe
+    uint64_t  Length;         //!< Total length, in bytes
+    byte      Pending[32];    //!< Incomplete stripe
+    uint32_t  Used;           //!< Length of incomplete stripe
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // XxHash64::XxHash64
+    //! Begin a checksum
+    //!
+    //! \param[in] seed - [optional] Seed
+    //////////////////////////////////////////////////////////////////////////////////////////
+    explicit XxHash64(uint64_t seed = 0) noexcept
+      : Seed(seed),
+        Lanes{seed + Prime1 + Prime2, seed + Prime2, seed, seed - Prime1},
+        Length(0),
+        Used(0)
+    {}
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    static uint64_t rotate(uint64_t value, int bits) noexcept
+    {
+      return (value << bits) | (value >> (64 - bits));
+    }
+
+    static uint64_t read64(const byte* pos) noexcept
+    {
+      uint64_t value;
+      std::memcpy(&value, pos, sizeof(value));
+      return value;
+    }
+
+    static uint64_t round(uint64_t acc, uint64_t input) noexcept
+    {
+      return rotate(acc + input * Prime2, 31) * Prime1;
+    }
+
+    static uint64_t merge(uint64_t acc, uint64_t lane) noexcept
+    {
+      return (acc ^ round(0, lane)) * Prime1 + Prime4;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // XxHash64::value const
+    //! Get the checksum of the data so far
+    //////////////////////////////////////////////////////////////////////////////////////////
+    value_type value() const noexcept
+    {
+      uint64_t h = Length >= 32
+                 ? merge(merge(merge(merge(rotate(Lanes[0], 1) + rotate(Lanes[1], 7) + rotate(Lanes[2], 12) + rotate(Lanes[3], 18),
+                                           Lanes[0]), Lanes[1]), Lanes[2]), Lanes[3])
+                 : Seed + Prime5;
+      h += Length;
+
+      // Consume incomplete stripe
+      const byte* pos = Pending;
+      const byte* const end = Pending + Used;
+      for (; pos + 8 <= end; pos += 8)
+        h = rotate(h ^ round(0, read64(pos)), 27) * Prime1 + Prime4;
+
+      if (pos + 4 <= end)
+      {
+        uint32_t word;
+        std::memcpy(&word, pos, 4);
+        h = rotate(h ^ (word * Prime1), 23) * Prime2 + Prime3;
+        pos += 4;
+      }
+
+      for (; pos < end; ++pos)
+        h = rotate(h ^ (*pos * Prime5), 11) * Prime1;
+
+      // Avalanche
+      h ^= h >> 33;
+      h *= Prime2;
+      h ^= h >> 29;
+      h *= Prime3;
+      return h ^ (h >> 32);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // XxHash64::update
+    //! Appends data to the checksum
+    //!
+    //! \param[in] const* data - Data
+    //! \param[in] length - Length of data, in bytes
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void update(const void* data, size_t length) noexcept
+    {
+      const byte* pos = static_cast<const byte*>(data);
+      const byte* const end = pos + length;
+      Length += length;
+
+      // Complete pending stripe
+      if (Used)
+      {
+        size_t chunk = std::min<size_t>(length, 32 - Used);
+        std::memcpy(Pending + Used, pos, chunk);
+        Used += static_cast<uint32_t>(chunk);
+        pos += chunk;
+
+        if (Used < 32)
+          return;
+
+        for (uint32_t lane = 0; lane < 4; ++lane)
+          Lanes[lane] = round(Lanes[lane], read64(Pending + 8*lane));
+        Used = 0;
+      }
+
+      // Consume whole stripes
+      for (; end - pos >= 32; pos += 32)
+      {
+        Lanes[0] = round(Lanes[0], read64(pos));
+        Lanes[1] = round(Lanes[1], read64(pos + 8));
+        Lanes[2] = round(Lanes[2], read64(pos + 16));
+        Lanes[3] = round(Lanes[3], read64(pos + 24));
+      }
+
+      // Retain remainder
+      if (pos < end)
+      {
+        std::memcpy(Pending, pos, end - pos);
+        Used = static_cast<uint32_t>(end - pos);
+      }
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_CHECKSUM_HPP
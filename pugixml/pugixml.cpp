@@ -42,6 +42,20 @@
 // For placement new
 #include <new>
 
+// SIMD character-class scanning (x86 only; the widest instruction set enabled at compile time is used)
+#if !defined(PUGIXML_WCHAR_MODE) && !defined(PUGIXML_NO_SIMD)
+#	if defined(__AVX2__)
+#		include <immintrin.h>
+#		define PUGI__SIMD_WIDTH 32
+#	elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		include <emmintrin.h>
+#		define PUGI__SIMD_WIDTH 16
+#	endif
+#	if defined(PUGI__SIMD_WIDTH) && defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#endif
+
 #ifdef _MSC_VER
 #	pragma warning(push)
 #	pragma warning(disable: 4127) // conditional expression is constant
@@ -1114,6 +1128,149 @@ PUGI__NS_BEGIN
 	#define PUGI__IS_CHARTYPE(c, ct) PUGI__IS_CHARTYPE_IMPL(c, ct, chartype_table)
 	#define PUGI__IS_CHARTYPEX(c, ct) PUGI__IS_CHARTYPE_IMPL(c, ct, chartypex_table)
 
+#ifdef PUGI__SIMD_WIDTH
+	// Vector operations for the enabled instruction set
+#	if PUGI__SIMD_WIDTH == 32
+	typedef __m256i simd_t;
+
+	#define PUGI__SIMD_LOADU(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+	#define PUGI__SIMD_SET1(c) _mm256_set1_epi8(static_cast<char>(c))
+	#define PUGI__SIMD_CMPEQ(a, b) _mm256_cmpeq_epi8(a, b)
+	#define PUGI__SIMD_CMPGT(a, b) _mm256_cmpgt_epi8(a, b)
+	#define PUGI__SIMD_OR(a, b) _mm256_or_si256(a, b)
+	#define PUGI__SIMD_AND(a, b) _mm256_and_si256(a, b)
+	#define PUGI__SIMD_MOVEMASK(v) static_cast<unsigned int>(_mm256_movemask_epi8(v))
+#	else
+	typedef __m128i simd_t;
+
+	#define PUGI__SIMD_LOADU(p) _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+	#define PUGI__SIMD_SET1(c) _mm_set1_epi8(static_cast<char>(c))
+	#define PUGI__SIMD_CMPEQ(a, b) _mm_cmpeq_epi8(a, b)
+	#define PUGI__SIMD_CMPGT(a, b) _mm_cmpgt_epi8(a, b)
+	#define PUGI__SIMD_OR(a, b) _mm_or_si128(a, b)
+	#define PUGI__SIMD_AND(a, b) _mm_and_si128(a, b)
+	#define PUGI__SIMD_MOVEMASK(v) static_cast<unsigned int>(_mm_movemask_epi8(v))
+#	endif
+
+	#define PUGI__SIMD_ANY(v, c) PUGI__SIMD_CMPEQ(v, PUGI__SIMD_SET1(c))
+	#define PUGI__SIMD_RANGE(v, lo, hi) PUGI__SIMD_AND(PUGI__SIMD_CMPGT(v, PUGI__SIMD_SET1((lo) - 1)), PUGI__SIMD_CMPGT(PUGI__SIMD_SET1((hi) + 1), v))
+
+	// Loads past the terminator stay within its page but may touch bytes outside the allocation
+#	if defined(__GNUC__) || defined(__clang__)
+	#define PUGI__SIMD_NO_SANITIZE __attribute__((no_sanitize_address))
+#	else
+	#define PUGI__SIMD_NO_SANITIZE
+#	endif
+
+	PUGI__FN unsigned int simd_first_bit(unsigned int mask)
+	{
+	#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<unsigned int>(index);
+	#else
+		return static_cast<unsigned int>(__builtin_ctz(mask));
+	#endif
+	}
+#endif
+
+	// Character classes terminating a scan; every class includes the zero terminator
+	struct chars_pcdata // \0, &, \r, <
+	{
+		static bool test(char_t c) { return PUGI__IS_CHARTYPE(c, ct_parse_pcdata) != 0; }
+
+	#ifdef PUGI__SIMD_WIDTH
+		static unsigned int test(simd_t v)
+		{
+			return PUGI__SIMD_MOVEMASK(PUGI__SIMD_OR(PUGI__SIMD_OR(PUGI__SIMD_ANY(v, 0), PUGI__SIMD_ANY(v, '&')), PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '\r'), PUGI__SIMD_ANY(v, '<'))));
+		}
+	#endif
+	};
+
+	struct chars_attr // \0, &, \r, ', "
+	{
+		static bool test(char_t c) { return PUGI__IS_CHARTYPE(c, ct_parse_attr) != 0; }
+
+	#ifdef PUGI__SIMD_WIDTH
+		static simd_t match(simd_t v)
+		{
+			return PUGI__SIMD_OR(PUGI__SIMD_OR(PUGI__SIMD_ANY(v, 0), PUGI__SIMD_ANY(v, '&')), PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '\r'), PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '\''), PUGI__SIMD_ANY(v, '"'))));
+		}
+
+		static unsigned int test(simd_t v) { return PUGI__SIMD_MOVEMASK(match(v)); }
+	#endif
+	};
+
+	struct chars_attr_ws // \0, &, \r, ', ", \n, tab
+	{
+		static bool test(char_t c) { return PUGI__IS_CHARTYPE(c, ct_parse_attr_ws) != 0; }
+
+	#ifdef PUGI__SIMD_WIDTH
+		static simd_t match(simd_t v) { return PUGI__SIMD_OR(chars_attr::match(v), PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '\n'), PUGI__SIMD_ANY(v, '\t'))); }
+
+		static unsigned int test(simd_t v) { return PUGI__SIMD_MOVEMASK(match(v)); }
+	#endif
+	};
+
+	struct chars_attr_ws_space // \0, &, \r, ', ", \n, tab, space
+	{
+		static bool test(char_t c) { return PUGI__IS_CHARTYPE(c, ct_parse_attr_ws | ct_space) != 0; }
+
+	#ifdef PUGI__SIMD_WIDTH
+		static unsigned int test(simd_t v) { return PUGI__SIMD_MOVEMASK(PUGI__SIMD_OR(chars_attr_ws::match(v), PUGI__SIMD_ANY(v, ' '))); }
+	#endif
+	};
+
+	struct chars_not_symbol // Any character other than a symbol > 127, a-z, A-Z, 0-9, _, :, -, .
+	{
+		static bool test(char_t c) { return !PUGI__IS_CHARTYPE(c, ct_symbol); }
+
+	#ifdef PUGI__SIMD_WIDTH
+		static unsigned int test(simd_t v)
+		{
+			simd_t high = PUGI__SIMD_CMPGT(PUGI__SIMD_SET1(0), v); // > 127 is negative when signed
+			simd_t alpha = PUGI__SIMD_RANGE(PUGI__SIMD_OR(v, PUGI__SIMD_SET1(0x20)), 'a', 'z');
+			simd_t digit = PUGI__SIMD_RANGE(v, '0', '9');
+			simd_t punct = PUGI__SIMD_OR(PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '_'), PUGI__SIMD_ANY(v, ':')), PUGI__SIMD_OR(PUGI__SIMD_ANY(v, '-'), PUGI__SIMD_ANY(v, '.')));
+
+			unsigned int symbol = PUGI__SIMD_MOVEMASK(PUGI__SIMD_OR(PUGI__SIMD_OR(high, alpha), PUGI__SIMD_OR(digit, punct)));
+
+		#if PUGI__SIMD_WIDTH == 32
+			return ~symbol;
+		#else
+			return ~symbol & 0xffff;
+		#endif
+		}
+	#endif
+	};
+
+	// Advances to the first character of the class; the buffer must contain a zero terminator at or after s
+#ifdef PUGI__SIMD_WIDTH
+	template <typename chars> PUGI__SIMD_NO_SANITIZE char_t* scan_until(char_t* s)
+	{
+		for (;;)
+		{
+			// Loads never cross into a page beyond the one holding the terminator; near a page end, test one character
+			if ((reinterpret_cast<uintptr_t>(s) & 4095) > 4096 - PUGI__SIMD_WIDTH)
+			{
+				if (chars::test(*s)) return s;
+				++s;
+			}
+			else if (unsigned int mask = chars::test(PUGI__SIMD_LOADU(s)))
+				return s + simd_first_bit(mask);
+			else
+				s += PUGI__SIMD_WIDTH;
+		}
+	}
+#else
+	template <typename chars> char_t* scan_until(char_t* s)
+	{
+		while (!chars::test(*s)) ++s;
+
+		return s;
+	}
+#endif
+
 	PUGI__FN bool is_little_endian()
 	{
 		unsigned int ui = 1;
@@ -1885,7 +2042,7 @@ PUGI__NS_BEGIN
 
 			while (true)
 			{
-				while (!PUGI__IS_CHARTYPE(*s, ct_parse_pcdata)) ++s;
+				s = scan_until<chars_pcdata>(s);
 					
 				if (*s == '<') // PCDATA ends here
 				{
@@ -1965,7 +2122,7 @@ PUGI__NS_BEGIN
 
 			while (true)
 			{
-				while (!PUGI__IS_CHARTYPE(*s, ct_parse_attr_ws | ct_space)) ++s;
+				s = scan_until<chars_attr_ws_space>(s);
 				
 				if (*s == end_quote)
 				{
@@ -2006,7 +2163,7 @@ PUGI__NS_BEGIN
 
 			while (true)
 			{
-				while (!PUGI__IS_CHARTYPE(*s, ct_parse_attr_ws)) ++s;
+				s = scan_until<chars_attr_ws>(s);
 				
 				if (*s == end_quote)
 				{
@@ -2042,7 +2199,7 @@ PUGI__NS_BEGIN
 
 			while (true)
 			{
-				while (!PUGI__IS_CHARTYPE(*s, ct_parse_attr)) ++s;
+				s = scan_until<chars_attr>(s);
 				
 				if (*s == end_quote)
 				{
@@ -2074,7 +2231,7 @@ PUGI__NS_BEGIN
 
 			while (true)
 			{
-				while (!PUGI__IS_CHARTYPE(*s, ct_parse_attr)) ++s;
+				s = scan_until<chars_attr>(s);
 				
 				if (*s == end_quote)
 				{
@@ -2386,7 +2543,7 @@ PUGI__NS_BEGIN
 
 			if (!PUGI__IS_CHARTYPE(*s, ct_start_symbol)) PUGI__THROW_ERROR(status_bad_pi, s);
 
-			PUGI__SCANWHILE(PUGI__IS_CHARTYPE(*s, ct_symbol));
+			s = scan_until<chars_not_symbol>(s);
 			PUGI__CHECK_ERROR(status_bad_pi, s);
 
 			// determine node type; stricmp / strcasecmp is not portable
@@ -2487,7 +2644,7 @@ PUGI__NS_BEGIN
 
 						cursor->name = s;
 
-						PUGI__SCANWHILE(PUGI__IS_CHARTYPE(*s, ct_symbol)); // Scan for a terminator.
+						s = scan_until<chars_not_symbol>(s); // Scan for a terminator.
 						PUGI__ENDSEG(); // Save char in 'ch', terminate & step over.
 
 						if (ch == '>')
@@ -2508,7 +2665,7 @@ PUGI__NS_BEGIN
 
 									a->name = s; // Save the offset.
 
-									PUGI__SCANWHILE(PUGI__IS_CHARTYPE(*s, ct_symbol)); // Scan for a terminator.
+									s = scan_until<chars_not_symbol>(s); // Scan for a terminator.
 									PUGI__CHECK_ERROR(status_bad_attribute, s); //$ redundant, left for performance
 
 									PUGI__ENDSEG(); // Save char in 'ch', terminate & step over.
@@ -10607,6 +10764,17 @@ namespace pugi
 #undef PUGI__POPNODE
 #undef PUGI__SCANFOR
 #undef PUGI__SCANWHILE
+#undef PUGI__SIMD_WIDTH
+#undef PUGI__SIMD_LOADU
+#undef PUGI__SIMD_SET1
+#undef PUGI__SIMD_CMPEQ
+#undef PUGI__SIMD_CMPGT
+#undef PUGI__SIMD_OR
+#undef PUGI__SIMD_AND
+#undef PUGI__SIMD_MOVEMASK
+#undef PUGI__SIMD_ANY
+#undef PUGI__SIMD_RANGE
+#undef PUGI__SIMD_NO_SANITIZE
 #undef PUGI__ENDSEG
 #undef PUGI__THROW_ERROR
 #undef PUGI__CHECK_ERROR